@@ -0,0 +1,4 @@
+#pragma once
+
+#include "puzzle_factory.hpp"
+#include "types.hpp"
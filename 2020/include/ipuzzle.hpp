@@ -0,0 +1,31 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cstdint>
+#include <string>
+#include <variant>
+
+namespace AOC::Y2020
+{
+
+class IPuzzle
+{
+public:
+    using Solution_t = std::variant<std::monostate, std::int64_t, std::string>;
+
+public:
+    virtual ~IPuzzle() = default;
+
+    [[nodiscard]] virtual Solution_t Part1() = 0;
+    [[nodiscard]] virtual Solution_t Part2() = 0;
+
+protected:
+    IPuzzle() = default;
+    IPuzzle(const IPuzzle &) = default;
+    IPuzzle(IPuzzle &&) = default;
+    IPuzzle &operator=(const IPuzzle &) = default;
+    IPuzzle &operator=(IPuzzle &&) = default;
+};
+
+} // namespace AOC::Y2020
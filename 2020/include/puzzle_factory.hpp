@@ -0,0 +1,19 @@
+#pragma once
+
+#include "ipuzzle.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+class AOC_Y2020_API PuzzleFactory final
+{
+public:
+    static std::unique_ptr<IPuzzle> CreatePuzzle(std::uint8_t day, std::string_view input);
+};
+
+} // namespace AOC::Y2020
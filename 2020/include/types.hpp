@@ -0,0 +1,5 @@
+#pragma once
+
+#if !defined(AOC_Y2020_API)
+#define AOC_Y2020_API
+#endif
@@ -1,67 +1,87 @@
-#include "input_2020_01_a.h"
+#include "NumberConversions.hpp"
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
 
-#include <iostream>
 #include <algorithm>
-#include <array>
+#include <cstdint>
 #include <optional>
+#include <string_view>
 #include <utility>
+#include <vector>
+
+namespace AOC::Y2020
+{
+
+namespace
+{
 
 using num_t = std::uint32_t;
 using std::size_t;
 
-template <size_t Size>
-std::optional<std::pair<num_t, num_t>> FindExpenseReportEntries(const num_t (&aUnsortedInput)[Size], num_t expectedSum)
-{
-    const std::array<num_t, Size> aSortedInput = [&aUnsortedInput]() {
-        std::array<num_t, Size> aToSort{};
-        for (size_t i = 0u; i < Size; ++i)
-        {
-            aToSort[i] = aUnsortedInput[i];
-        }
-        std::sort(aToSort.begin(), aToSort.end());
-        return aToSort;
-    }();
+constexpr num_t expectedSum = 2020u;
 
-    auto it = std::find_if(aSortedInput.begin(), aSortedInput.end(), [&](const num_t lhs) {
-        auto it2 = std::find_if(aSortedInput.begin(), aSortedInput.end(),
+std::optional<std::pair<num_t, num_t>> FindExpenseReportEntries(const std::vector<num_t> &sortedInput, num_t expectedSum)
+{
+    auto it = std::find_if(sortedInput.begin(), sortedInput.end(), [&](const num_t lhs) {
+        auto it2 = std::find_if(sortedInput.begin(), sortedInput.end(),
                                 [lhs, expectedSum](const num_t rhs) { return (expectedSum == (lhs + rhs)); });
-        return it2 != aSortedInput.end();
+        return it2 != sortedInput.end();
     });
-    if (it == aSortedInput.end())
+    if (it == sortedInput.end())
     {
         return std::nullopt;
     }
     return std::make_pair(*it, expectedSum - (*it));
 }
 
-int main()
+} // namespace
+
+class PuzzleDay01Impl final
 {
-    std::cout << "==Day 01==\n";
+public:
+    explicit PuzzleDay01Impl(const std::string_view input)
+    {
+        const bool parsed = ParseLines(input, [this](const std::string_view &line) {
+            if (line.empty())
+            {
+                return true;
+            }
+            num_t entry{};
+            if (!ReadFromSv(entry, line, 0u, line.size()))
+            {
+                return false;
+            }
+            unsortedInput.push_back(entry);
+            return true;
+        });
+        if (!parsed)
+        {
+            unsortedInput.clear();
+        }
+        sortedInput = unsortedInput;
+        std::sort(sortedInput.begin(), sortedInput.end());
+    }
 
-    constexpr num_t expectedSum = 2020u;
-    constexpr num_t aUnsortedInput[] = {AOC_INPUT_2020_01_A};
+    [[nodiscard]] std::optional<std::int64_t> Part1() const
     {
-        std::cout << "=Part 1=\n";
-        auto entryPair = FindExpenseReportEntries(aUnsortedInput, expectedSum);
+        const auto entryPair = FindExpenseReportEntries(sortedInput, expectedSum);
         if (!entryPair.has_value())
         {
-            std::cout << "No entry pair found\n";
-            return 1;
+            return std::nullopt;
         }
-        std::cout << "Sum of entries [" << entryPair.value().first << ", " << entryPair.value().second << "] is " << expectedSum
-                  << "\n";
-        std::cout << "Product of these entries: " << entryPair.value().first * entryPair.value().second << "\n";
+        return std::int64_t{entryPair.value().first} * entryPair.value().second;
     }
+
+    [[nodiscard]] std::optional<std::int64_t> Part2() const
     {
-        std::cout << "=Part 2=\n";
-        for (const auto entry : aUnsortedInput)
+        for (const auto entry : unsortedInput)
         {
             if (entry > expectedSum)
             {
                 continue;
             }
             const num_t expectedSumFurtherEntries = expectedSum - entry;
-            const auto furtherEntries = FindExpenseReportEntries(aUnsortedInput, expectedSumFurtherEntries);
+            const auto furtherEntries = FindExpenseReportEntries(sortedInput, expectedSumFurtherEntries);
             if (!furtherEntries.has_value())
             {
                 continue;
@@ -70,12 +90,40 @@ int main()
             {
                 continue;
             }
-            std::cout << "Sum of entries [" << entry << ", " << furtherEntries.value().first << ", "
-                      << furtherEntries.value().second << "] is " << expectedSum << "\n";
-            std::cout << "Product of these entries: " << entry * furtherEntries.value().first * furtherEntries.value().second
-                      << "\n";
-            return 0;
+            return std::int64_t{entry} * furtherEntries.value().first * furtherEntries.value().second;
         }
-        return 1;
+        return std::nullopt;
+    }
+
+private:
+    std::vector<num_t> unsortedInput;
+    std::vector<num_t> sortedInput;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(01)
+
+PuzzleDay01::PuzzleDay01(const std::string_view input) : pImpl(std::make_unique<PuzzleDay01Impl>(input)) {}
+
+PuzzleDay01::~PuzzleDay01() = default;
+
+IPuzzle::Solution_t PuzzleDay01::Part1()
+{
+    const auto result = pImpl->Part1();
+    if (!result.has_value())
+    {
+        return std::monostate{};
+    }
+    return result.value();
+}
+
+IPuzzle::Solution_t PuzzleDay01::Part2()
+{
+    const auto result = pImpl->Part2();
+    if (!result.has_value())
+    {
+        return std::monostate{};
     }
+    return result.value();
 }
+
+} // namespace AOC::Y2020
@@ -1,13 +1,20 @@
-#include "input_2020_02_a.h"
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
 
 #include <algorithm>
-#include <array>
 #include <charconv>
-#include <iostream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+namespace AOC::Y2020
+{
+
+namespace
+{
+
 using std::size_t;
 using string_t = std::string_view;
 
@@ -22,6 +29,10 @@ struct PasswordPolicy
     explicit PasswordPolicy(const string_t policyString)
     {
         const auto [boundaries, specialLetterString] = SplitString(policyString, " ");
+        if (specialLetterString.empty())
+        {
+            throw std::invalid_argument{"invalid_argument"};
+        }
         m_specialLetter = specialLetterString[0];
         const auto [minString, maxString] = SplitString(policyString, "-");
         auto [pMin, ecMin] = std::from_chars(minString.data(), minString.data() + minString.size(), m_minOccurrence);
@@ -45,52 +56,87 @@ struct PasswordListEntry
         {
             return false;
         }
-        const size_t occurrences = std::count(m_password.begin(), m_password.end(), m_policy.m_specialLetter);
+        const auto occurrences = static_cast<size_t>(std::count(m_password.begin(), m_password.end(), m_policy.m_specialLetter));
         return ((occurrences >= m_policy.m_minOccurrence) && (occurrences <= m_policy.m_maxOccurrence));
     }
     [[nodiscard]] bool IsValidPolicy2() const
     {
         const auto passwordSize = m_password.size();
         if ((passwordSize < 1u) || (m_policy.m_minOccurrence == m_policy.m_maxOccurrence) || (m_policy.m_minOccurrence < 1u) ||
-            (m_policy.m_maxOccurrence < 1u) || (m_policy.m_minOccurrence > passwordSize) ||
-            (m_policy.m_maxOccurrence > passwordSize))
+            (m_policy.m_maxOccurrence < 1u) || (m_policy.m_minOccurrence >= passwordSize) ||
+            (m_policy.m_maxOccurrence >= passwordSize))
         {
             return false;
         }
+        // the password keeps the blank following the colon, therefore the 1-based policy positions index it directly
         const bool doesMatchFirst = m_password[m_policy.m_minOccurrence] == m_policy.m_specialLetter;
         const bool doesMatchSecond = m_password[m_policy.m_maxOccurrence] == m_policy.m_specialLetter;
         const bool doesExactlyOneMatch = doesMatchFirst != doesMatchSecond;
         return doesExactlyOneMatch;
     }
     const PasswordPolicy m_policy;
-    const string_t m_password;
+    const std::string m_password;
 };
 
-int main()
-{
-    std::cout << "==Day 02==\n";
+} // namespace
 
-    constexpr string_t aInput[] = AOC_INPUT_2020_02_A;
-    std::vector<PasswordListEntry> passwordList;
-    passwordList.reserve(sizeof(aInput) / sizeof(*aInput));
-    for (const auto &line : aInput)
+class PuzzleDay02Impl final
+{
+public:
+    explicit PuzzleDay02Impl(const std::string_view input)
     {
-        const auto splitLine = SplitString(line, ":");
-        passwordList.emplace_back(splitLine.first, splitLine.second);
+        try
+        {
+            ParseLines(input, [this](const std::string_view &line) {
+                if (!line.empty())
+                {
+                    const auto splitLine = SplitString(line, ":");
+                    passwordList.emplace_back(splitLine.first, splitLine.second);
+                }
+                return true;
+            });
+        }
+        catch (const std::invalid_argument & /* e */)
+        {
+            passwordList.clear();
+        }
     }
 
+    [[nodiscard]] std::int64_t CountValidPasswords(const bool bPolicy2) const
     {
-        std::cout << "=Part 1=\n";
-        const auto numOfValidPasswords =
-            std::count_if(passwordList.begin(), passwordList.end(), [](const auto &entry) { return entry.IsValidPolicy1(); });
-        std::cout << "Number of valid passwords: " << numOfValidPasswords << "\n";
+        return std::count_if(passwordList.begin(), passwordList.end(), [bPolicy2](const auto &entry) {
+            return bPolicy2 ? entry.IsValidPolicy2() : entry.IsValidPolicy1();
+        });
     }
+
+    [[nodiscard]] bool empty() const { return passwordList.empty(); }
+
+private:
+    std::vector<PasswordListEntry> passwordList;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(02)
+
+PuzzleDay02::PuzzleDay02(const std::string_view input) : pImpl(std::make_unique<PuzzleDay02Impl>(input)) {}
+
+PuzzleDay02::~PuzzleDay02() = default;
+
+IPuzzle::Solution_t PuzzleDay02::Part1()
+{
+    if (pImpl->empty())
     {
-        std::cout << "=Part 2=\n";
-        const auto numOfValidPasswords =
-            std::count_if(passwordList.begin(), passwordList.end(), [](const auto &entry) { return entry.IsValidPolicy2(); });
-        std::cout << "Number of valid passwords: " << numOfValidPasswords << "\n";
+        return std::monostate{};
     }
+    return pImpl->CountValidPasswords(false);
+}
 
-    return 0;
+IPuzzle::Solution_t PuzzleDay02::Part2()
+{
+    if (pImpl->empty())
+    {
+        return std::monostate{};
+    }
+    return pImpl->CountValidPasswords(true);
 }
+
+} // namespace AOC::Y2020
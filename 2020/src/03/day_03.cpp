@@ -1,10 +1,20 @@
-#include <fstream>
-#include <iostream>
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
+#include <cstdint>
+#include <iterator>
 #include <numeric>
-#include <optional>
-#include <string>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+namespace AOC::Y2020
+{
+
+namespace
+{
+
 using std::size_t;
 
 enum class MapItem
@@ -17,22 +27,6 @@ enum class MapItem
 constexpr char MapItemCharTree = '#';
 constexpr char MapItemCharOpen = '.';
 
-constexpr char MapItemToChar(MapItem item)
-{
-    switch (item)
-    {
-        case MapItem::Tree:
-            return MapItemCharTree;
-        case MapItem::Open:
-            return MapItemCharOpen;
-        case MapItem::Max:
-            [[fallthrough]];
-        default:
-            throw std::runtime_error("Invalid Item");
-            break;
-    }
-}
-
 constexpr MapItem MapItemFromChar(const char c)
 {
     switch (c)
@@ -53,36 +47,22 @@ public:
     using row_t = uint32_t;
 
 public:
-    explicit Terrain(size_t width) : m_width(width)
-    {
-        if (m_width > (8 * sizeof(row_t)))
-        {
-            throw std::runtime_error("Map too wide");
-        }
-    }
-
-    explicit Terrain(const std::string &filename)
+    explicit Terrain(const std::string_view input)
     {
-        std::ifstream inputFile(filename.c_str(), std::ifstream::in);
-        if (!inputFile.good())
-        {
-            throw std::runtime_error("Map too wide");
-        }
-        std::string line;
-        bool isFirstLine = true;
-        while (std::getline(inputFile, line))
-        {
-            if (isFirstLine)
+        ParseLines(input, [this](const std::string_view &line) {
+            if (line.empty())
+            {
+                return true;
+            }
+            if (m_width == 0u)
             {
                 m_width = line.size();
-                isFirstLine = false;
             }
-            this->AddRow(line);
-        }
-        inputFile.close();
+            return this->AddRow(line);
+        });
     }
 
-    bool AddRow(const std::string &geography)
+    bool AddRow(const std::string_view &geography)
     {
         if (geography.size() > (8 * sizeof(row_t)))
         {
@@ -135,45 +115,74 @@ private:
         xPos += rightIncrement;
         yPos += downIncrement;
     }
-    std::cout << treeCount << std::endl;
     return treeCount;
 }
 
-int main(int argc, const char *argv[])
+} // namespace
+
+class PuzzleDay03Impl final
 {
-    std::cout << "==Day 03==\n";
-    if (argc < 2)
+public:
+    explicit PuzzleDay03Impl(const std::string_view input) : areaMap(input) {}
+
+    [[nodiscard]] std::int64_t Part1() const
     {
-        std::cout << "Please specify an input file\n";
-        return 1;
+        const size_t rightIncrement = 3u;
+        const size_t downIncrement = 1u;
+        return static_cast<std::int64_t>(CountTreesOnRoute(areaMap, rightIncrement, downIncrement));
     }
+
+    [[nodiscard]] std::int64_t Part2() const
+    {
+        constexpr std::pair<size_t, size_t> aSlopes[] = {
+            {1u, 1u}, {3u, 1u}, {5u, 1u}, {7u, 1u}, {1u, 2u},
+        };
+        const std::uint64_t treeProduct =
+            std::accumulate(std::begin(aSlopes), std::end(aSlopes), std::uint64_t{1u},
+                            [this](std::uint64_t accumulator, const auto &slope) {
+                                return accumulator * CountTreesOnRoute(areaMap, slope.first, slope.second);
+                            });
+        return static_cast<std::int64_t>(treeProduct);
+    }
+
+    [[nodiscard]] bool empty() const { return (areaMap.GetHeight() == 0u); }
+
+private:
+    const Terrain areaMap;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(03)
+
+PuzzleDay03::PuzzleDay03(const std::string_view input)
+{
     try
     {
-        const Terrain areaMap = Terrain(argv[1u]);
-        {
-            std::cout << "=Part 1=\n";
-            const size_t rightIncrement = 3u;
-            const size_t downIncrement = 1u;
-            const auto treeCount = CountTreesOnRoute(areaMap, rightIncrement, downIncrement);
-            std::cout << "We have encountered " << treeCount << " trees.\n";
-        }
-        {
-            std::cout << "=Part 2=\n";
-            std::pair<size_t, size_t> aSlopes[] = {
-                {1u, 1u}, {3u, 1u}, {5u, 1u}, {7u, 1u}, {1u, 2u},
-            };
-            uint64_t treeProduct = std::accumulate(std::begin(aSlopes), std::end(aSlopes), 1ull,
-                                                   [&areaMap](uint64_t accumulator, const auto &slope) {
-                                                       return accumulator * CountTreesOnRoute(areaMap, slope.first, slope.second);
-                                                   });
-            std::cout << "Product of number of trees on all slopes: " << treeProduct << "\n";
-        }
+        pImpl = std::make_unique<PuzzleDay03Impl>(input);
+    }
+    catch (const std::exception & /* e */)
+    {
+        pImpl.reset();
     }
-    catch (std::exception & /*e*/)
+}
+
+PuzzleDay03::~PuzzleDay03() = default;
+
+IPuzzle::Solution_t PuzzleDay03::Part1()
+{
+    if (!pImpl || pImpl->empty())
     {
-        std::cout << "Failed to parse input";
-        return 1;
+        return std::monostate{};
     }
+    return pImpl->Part1();
+}
 
-    return 0;
+IPuzzle::Solution_t PuzzleDay03::Part2()
+{
+    if (!pImpl || pImpl->empty())
+    {
+        return std::monostate{};
+    }
+    return pImpl->Part2();
 }
+
+} // namespace AOC::Y2020
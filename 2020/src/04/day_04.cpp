@@ -1,11 +1,21 @@
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
 #include <algorithm>
 #include <array>
 #include <cassert>
-#include <fstream>
-#include <iostream>
+#include <cctype>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <utility>
 
+namespace AOC::Y2020
+{
+
+namespace
+{
+
 class Passport
 {
 public:
@@ -252,73 +262,73 @@ private:
     std::array<std::string, Field::Max> m_aFields;
 };
 
-[[nodiscard]] int ReadPassportFile(const char *filename)
+} // namespace
+
+class PuzzleDay04Impl final
 {
-    if (nullptr == filename)
-    {
-        return 1;
-    }
-    std::ifstream inputFile(filename, std::ifstream::in);
-    if (!inputFile.good())
+public:
+    explicit PuzzleDay04Impl(const std::string_view input)
     {
-        return 1;
-    }
-    size_t mandatoryPresentCount = 0u;
-    size_t validPassportsCount = 0u;
-    const auto processRecord = [&mandatoryPresentCount, &validPassportsCount](std::string &record) {
-        if (!record.empty())
-        {
-            Passport passport(record);
-            record = "";
-            if (passport.AreMandatoryFieldsPresent())
+        const auto processRecord = [this](std::string &record) {
+            if (!record.empty())
             {
-                mandatoryPresentCount++;
+                Passport passport(record);
+                record = "";
+                if (passport.AreMandatoryFieldsPresent())
+                {
+                    mandatoryPresentCount++;
+                }
+                if (passport.AreMandatoryFieldsValid())
+                {
+                    validPassportsCount++;
+                }
+                passportsCount++;
             }
-            if (passport.AreMandatoryFieldsValid())
+        };
+        std::string record;
+        ParseLines(input, [&record, &processRecord](const std::string_view &line) {
+            if (line.empty())
             {
-                validPassportsCount++;
+                processRecord(record);
             }
-        }
-    };
-    std::string record;
-    std::string line;
-    while (std::getline(inputFile, line))
-    {
-        if (line.empty())
-        {
-            processRecord(record);
-        }
-        else
-        {
-            record += " " + line;
-        }
-    }
-    processRecord(record);
-    {
-        std::cout << "=Part 1=\n";
-        std::cout << "All mandatory fields valid in " << mandatoryPresentCount << " passports\n";
+            else
+            {
+                record += ' ';
+                record += line;
+            }
+            return true;
+        });
+        processRecord(record);
     }
+
+public:
+    std::int64_t passportsCount{0};
+    std::int64_t mandatoryPresentCount{0};
+    std::int64_t validPassportsCount{0};
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(04)
+
+PuzzleDay04::PuzzleDay04(const std::string_view input) : pImpl(std::make_unique<PuzzleDay04Impl>(input)) {}
+
+PuzzleDay04::~PuzzleDay04() = default;
+
+IPuzzle::Solution_t PuzzleDay04::Part1()
+{
+    if (pImpl->passportsCount == 0)
     {
-        std::cout << "=Part 2=\n";
-        std::cout << "Valid passports: " << validPassportsCount << "\n";
+        return std::monostate{};
     }
-    return 0;
+    return pImpl->mandatoryPresentCount;
 }
 
-int main(int argc, const char *argv[])
+IPuzzle::Solution_t PuzzleDay04::Part2()
 {
-    std::cout << "==Day 04==\n";
-    if (argc < 2)
+    if (pImpl->passportsCount == 0)
     {
-        std::cout << "Please specify an input file\n";
-        return 1;
+        return std::monostate{};
     }
-    const int ret = ReadPassportFile(argv[1u]);
-    if (0 != ret)
-    {
-        std::cerr << "Failed to read passports from file\n";
-        return 1;
-    }
-
-    return ret;
+    return pImpl->validPassportsCount;
 }
+
+} // namespace AOC::Y2020
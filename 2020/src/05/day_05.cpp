@@ -1,10 +1,18 @@
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
 #include <algorithm>
 #include <cassert>
-#include <fstream>
-#include <iostream>
-#include <string>
+#include <cstdint>
+#include <string_view>
 #include <vector>
 
+namespace AOC::Y2020
+{
+
+namespace
+{
+
 class Seat
 {
 public:
@@ -56,68 +64,71 @@ private:
     seatId_t m_seatId{};
 };
 
-[[nodiscard]] int ReadBoardingPassFile(const char *filename)
+} // namespace
+
+class PuzzleDay05Impl final
 {
-    if (nullptr == filename)
-    {
-        return 1;
-    }
-    std::ifstream inputFile(filename, std::ifstream::in);
-    if (!inputFile.good())
-    {
-        return 1;
-    }
-    std::vector<Seat> assignedSeats;
-    std::string line;
-    while (std::getline(inputFile, line))
-    {
-        if (!line.empty())
-        {
-            assignedSeats.emplace_back(line);
-        }
-    }
-    std::sort(assignedSeats.begin(), assignedSeats.end(),
-              [](const auto &lhs, const auto &rhs) { return (lhs.GetId() < rhs.GetId()); });
-    if (assignedSeats.size() < 1u)
-    {
-        std::cout << "No seats assigned";
-        return 1;
-    }
+public:
+    explicit PuzzleDay05Impl(const std::string_view input)
     {
-        std::cout << "=Part 1=\n";
-        const auto it = std::max_element(assignedSeats.begin(), assignedSeats.end(),
-                                         [](const auto &lhs, const auto &rhs) { return (lhs.GetId() < rhs.GetId()); });
-        std::cout << "Highest seat ID: " << it->GetId() << "\n";
+        ParseLines(input, [this](const std::string_view &line) {
+            if (!line.empty())
+            {
+                assignedSeats.emplace_back(line);
+            }
+            return true;
+        });
+        std::sort(assignedSeats.begin(), assignedSeats.end(),
+                  [](const auto &lhs, const auto &rhs) { return (lhs.GetId() < rhs.GetId()); });
     }
+
+    [[nodiscard]] std::int64_t FindHighestSeatId() const { return assignedSeats.back().GetId(); }
+
+    [[nodiscard]] std::int64_t FindOurSeatId() const
     {
-        std::cout << "=Part 2=\n";
         const auto beforeOurs =
             std::adjacent_find(assignedSeats.begin(), assignedSeats.end(),
                                [](const auto &current, const auto &next) { return ((current.GetId() + 2) == next.GetId()); });
         if (beforeOurs == assignedSeats.end())
         {
-            return 1;
+            return -1;
         }
-        const Seat::seatId_t ourSeatId = beforeOurs->GetId() + 1;
-        std::cout << "Our seat ID: " << ourSeatId << "\n";
+        return beforeOurs->GetId() + 1;
+    }
+
+    [[nodiscard]] bool empty() const { return assignedSeats.empty(); }
+
+private:
+    std::vector<Seat> assignedSeats;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(05)
+
+PuzzleDay05::PuzzleDay05(const std::string_view input) : pImpl(std::make_unique<PuzzleDay05Impl>(input)) {}
+
+PuzzleDay05::~PuzzleDay05() = default;
+
+IPuzzle::Solution_t PuzzleDay05::Part1()
+{
+    if (pImpl->empty())
+    {
+        return std::monostate{};
     }
-    return 0;
+    return pImpl->FindHighestSeatId();
 }
 
-int main(int argc, const char *argv[])
+IPuzzle::Solution_t PuzzleDay05::Part2()
 {
-    std::cout << "==Day 05==\n";
-    if (argc < 2)
+    if (pImpl->empty())
     {
-        std::cout << "Please specify an input file\n";
-        return 1;
+        return std::monostate{};
     }
-    const int ret = ReadBoardingPassFile(argv[1u]);
-    if (0 != ret)
+    const auto ourSeatId = pImpl->FindOurSeatId();
+    if (ourSeatId < 0)
     {
-        std::cerr << "Failed to read seat IDs from file\n";
-        return 1;
+        return std::monostate{};
     }
-
-    return ret;
+    return ourSeatId;
 }
+
+} // namespace AOC::Y2020
@@ -0,0 +1,123 @@
+#include "NumberConversions.hpp"
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+namespace
+{
+
+constexpr std::size_t maxLetters{26u};
+
+struct GroupDeclaration
+{
+    std::uint32_t anyoneYes;
+    std::uint32_t everyoneYes;
+};
+
+bool ParseSingleDeclaration(const std::string_view &line, std::uint32_t &declaration)
+{
+    declaration = 0u;
+    if (line.size() > maxLetters)
+    {
+        return false;
+    }
+    for (const char c : line)
+    {
+        if ((c < 'a') || (c > 'z'))
+        {
+            // invalid character
+            return false;
+        }
+
+        const auto answerIndex = static_cast<std::uint32_t>(c - 'a');
+        declaration |= 1ul << answerIndex;
+    }
+    return true;
+}
+
+std::uint32_t CountAnswerYes(const std::uint32_t declaration)
+{
+    return static_cast<std::uint32_t>(Popcount(declaration));
+}
+
+} // namespace
+
+class PuzzleDay06Impl final
+{
+public:
+    explicit PuzzleDay06Impl(const std::string_view input)
+    {
+        constexpr GroupDeclaration emptyGroup = {
+            0u,
+            // set flag to "yes" for all possible answers, will be reset if anyone answers "no"
+            (1ul << maxLetters) - 1u,
+        };
+        GroupDeclaration declarationsOfGroup = emptyGroup;
+        bool bGroupHasMembers = false;
+        const auto fnCompleteGroup = [this, &declarationsOfGroup, &bGroupHasMembers, &emptyGroup]() {
+            if (bGroupHasMembers)
+            {
+                sumOfGroupDeclarations.anyoneYes += CountAnswerYes(declarationsOfGroup.anyoneYes);
+                sumOfGroupDeclarations.everyoneYes += CountAnswerYes(declarationsOfGroup.everyoneYes);
+            }
+            declarationsOfGroup = emptyGroup;
+            bGroupHasMembers = false;
+        };
+        valid = ParseLines(input, [&](const std::string_view &line) {
+            if (line.empty())
+            {
+                fnCompleteGroup();
+                return true;
+            }
+            std::uint32_t individualDeclaration = 0u;
+            if (!ParseSingleDeclaration(line, individualDeclaration))
+            {
+                return false;
+            }
+            // Part 1
+            declarationsOfGroup.anyoneYes |= individualDeclaration;
+            // Part 2
+            // reset the group's bits corresponding to the questions the person didn't answer "yes"
+            declarationsOfGroup.everyoneYes &= individualDeclaration;
+            bGroupHasMembers = true;
+            return true;
+        });
+        fnCompleteGroup();
+    }
+
+public:
+    GroupDeclaration sumOfGroupDeclarations{0u, 0u};
+    bool valid{false};
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(06)
+
+PuzzleDay06::PuzzleDay06(const std::string_view input) : pImpl(std::make_unique<PuzzleDay06Impl>(input)) {}
+
+PuzzleDay06::~PuzzleDay06() = default;
+
+IPuzzle::Solution_t PuzzleDay06::Part1()
+{
+    if (!pImpl->valid)
+    {
+        return std::monostate{};
+    }
+    return std::int64_t{pImpl->sumOfGroupDeclarations.anyoneYes};
+}
+
+IPuzzle::Solution_t PuzzleDay06::Part2()
+{
+    if (!pImpl->valid)
+    {
+        return std::monostate{};
+    }
+    return std::int64_t{pImpl->sumOfGroupDeclarations.everyoneYes};
+}
+
+} // namespace AOC::Y2020
@@ -1,30 +1,26 @@
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
 #include <algorithm>
-#include <fstream>
-#include <iostream>
+#include <cstdint>
 #include <map>
 #include <numeric>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
-using std::size_t;
 
-static constexpr size_t maxRecursionDepth{30u};
+namespace AOC::Y2020
+{
 
 namespace
 {
 
-static constexpr std::string_view aExampleInput[] = {
-    "light red bags contain 1 bright white bag, 2 muted yellow bags.",
-    "dark orange bags contain 3 bright white bags, 4 muted yellow bags.",
-    "bright white bags contain 1 shiny gold bag.",
-    "muted yellow bags contain 2 shiny gold bags, 9 faded blue bags.",
-    "shiny gold bags contain 1 dark olive bag, 2 vibrant plum bags.",
-    "dark olive bags contain 3 faded blue bags, 4 dotted black bags.",
-    "vibrant plum bags contain 5 faded blue bags, 6 dotted black bags.",
-    "faded blue bags contain no other bags.",
-    "dotted black bags contain no other bags.",
-};
+using std::size_t;
+
+static constexpr size_t maxRecursionDepth{30u};
+
+constexpr std::string_view colorOfInterest = "shiny gold";
 
 class Bag
 {
@@ -157,114 +153,90 @@ private:
     std::map<std::string, std::size_t> m_containedBags;
 };
 
-bool ParseAndAddRule(const std::string_view ruleAsText, std::vector<Bag> &bagsWithRules)
+} // namespace
+
+class PuzzleDay07Impl final
 {
-    try
+public:
+    explicit PuzzleDay07Impl(const std::string_view input)
+    {
+        ParseLines(input, [this](const std::string_view &line) {
+            if (!line.empty())
+            {
+                bagsWithRules.emplace_back(line);
+            }
+            return true;
+        });
+    }
+
+    [[nodiscard]] std::int64_t CountBagsEventuallyContainingColorOfInterest() const
+    {
+        return std::count_if(bagsWithRules.begin(), bagsWithRules.end(), [this](const auto &bag) -> bool {
+            return (bag.ContainedQuantityOfColor(bagsWithRules, colorOfInterest) >= 1u);
+        });
+    }
+
+    [[nodiscard]] std::int64_t CountBagsNestedInColorOfInterest() const
     {
-        bagsWithRules.emplace_back(ruleAsText);
-        return true;
+        const auto it = std::find_if(bagsWithRules.begin(), bagsWithRules.end(),
+                                     [](const auto &bag) { return bag.DoesMatchColor(colorOfInterest); });
+        if (it == bagsWithRules.end())
+        {
+            throw std::runtime_error("Bag not found");
+        }
+        return static_cast<std::int64_t>(it->CountNestedBags(bagsWithRules));
     }
-    catch (std::runtime_error &e)
+
+private:
+    std::vector<Bag> bagsWithRules;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(07)
+
+PuzzleDay07::PuzzleDay07(const std::string_view input)
+{
+    try
     {
-        std::cerr << e.what();
+        pImpl = std::make_unique<PuzzleDay07Impl>(input);
     }
     catch (...)
     {
+        pImpl.reset();
     }
-    return false;
 }
 
-[[nodiscard]] int ReadLuggageRulesFromFile(const char *filename, std::vector<Bag> &bagsWithRules)
+PuzzleDay07::~PuzzleDay07() = default;
+
+IPuzzle::Solution_t PuzzleDay07::Part1()
 {
-    if (nullptr == filename)
+    if (!pImpl)
     {
-        return 1;
+        return std::monostate{};
     }
-    std::ifstream inputFile(filename, std::ifstream::in);
-    if (!inputFile.good())
+    try
     {
-        return 1;
+        return pImpl->CountBagsEventuallyContainingColorOfInterest();
     }
-    std::string line;
-    while (std::getline(inputFile, line))
+    catch (...)
     {
-        if (line.empty())
-        {
-            continue;
-        }
-        if (!ParseAndAddRule(line, bagsWithRules))
-        {
-            return 1;
-        }
+        return std::monostate{};
     }
-    return 0;
 }
 
-} // namespace
-
-int main(const int argc, const char *const argv[])
+IPuzzle::Solution_t PuzzleDay07::Part2()
 {
-    std::cout << "==Day 07==\n";
-    std::vector<Bag> bagsWithRules;
-    if (argc < 2)
-    {
-        std::cout << "Using example input. Alternatively, you can pass the path to an input file as command line argument\n";
-        for (const auto &line : aExampleInput)
-        {
-            if (!ParseAndAddRule(line, bagsWithRules))
-            {
-                return 1;
-            }
-        }
-    }
-    else
+    if (!pImpl)
     {
-        const int ret = ReadLuggageRulesFromFile(argv[1u], bagsWithRules);
-        if (0 != ret)
-        {
-            std::cerr << "Failed to read luggage rules from file\n";
-            return ret;
-        }
+        return std::monostate{};
     }
-    constexpr std::string_view colorOfInterterst = "shiny gold";
-    int ret = 0u;
-    std::cout << "Input parsing complete" << std::endl;
+    try
     {
-        std::cout << "=Part 1=\n";
-        try
-        {
-            const auto canAtLeastHoldOneBagOfColor = std::count_if(
-                bagsWithRules.begin(), bagsWithRules.end(), [&colorOfInterterst, &bagsWithRules](const auto &bag) -> bool {
-                    return (bag.ContainedQuantityOfColor(bagsWithRules, colorOfInterterst) >= 1u);
-                });
-            std::cout << "Number of bags which can eventually contain at least one " << colorOfInterterst
-                      << " bag: " << canAtLeastHoldOneBagOfColor << "\n";
-        }
-        catch (...)
-        {
-            std::cerr << "Calculation of part 1 failed";
-            ret = 1;
-        }
+        return pImpl->CountBagsNestedInColorOfInterest();
     }
+    catch (...)
     {
-        std::cout << "=Part 2=\n";
-        try
-        {
-            const auto it = std::find_if(bagsWithRules.begin(), bagsWithRules.end(),
-                                         [&colorOfInterterst](const auto &bag) { return bag.DoesMatchColor(colorOfInterterst); });
-            if (it == bagsWithRules.end())
-            {
-                throw;
-            }
-            const auto containedIndividualBags = it->CountNestedBags(bagsWithRules);
-            std::cout << "The " << colorOfInterterst << " bag contains " << containedIndividualBags << " individual bags.\n";
-        }
-        catch (...)
-        {
-            std::cerr << "Calculation of part 2 failed";
-            ret = 1;
-        }
+        return std::monostate{};
     }
-
-    return ret;
 }
+
+} // namespace AOC::Y2020
@@ -1,22 +1,27 @@
-#include <fstream>
-#include <iostream>
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
+#include <cstdint>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
 
-constexpr const char *aExampleInput[] = {
-    "nop +0", "acc +1", "jmp +4", "acc +3", "jmp -3", "acc -9", "acc +1", "jmp -4", "acc +6",
-};
+namespace AOC::Y2020
+{
+
+namespace
+{
+
+using std::size_t;
 
 #define AOC_OPCODE_LIST(_X_)                                                                                                     \
     _X_(acc)                                                                                                                     \
     _X_(jmp)                                                                                                                     \
     _X_(nop)
 
-namespace
-{
 enum class Opcode
 {
 #define AOC_OPCODE_ENUM_ENTRY(entry) entry,
@@ -87,7 +92,7 @@ bool ExecuteProgram(const Program_t &prog, int &accumulator)
     } while (true);
 }
 
-[[nodiscard]] Instruction ParseInstruction(const std::string &instruction)
+[[nodiscard]] Instruction ParseInstruction(const std::string_view &instruction)
 {
     const Opcode opcode = [&instruction]() -> Opcode {
 #define AOC_OPCODE_RETURN(opcode)                                                                                                \
@@ -99,147 +104,127 @@ bool ExecuteProgram(const Program_t &prog, int &accumulator)
         throw std::runtime_error("Unknown instruction");
     }();
     const auto argumentBeginPos = instruction.find_first_of(' ');
-    return {opcode, std::stoi(instruction.substr(argumentBeginPos))};
-}
-
-[[nodiscard]] Program_t LoadProgramFile(const char *const filename)
-{
-    if (nullptr == filename)
-    {
-        throw std::runtime_error("Filename is NULL");
-    }
-    std::ifstream inputFile(filename, std::ifstream::in);
-    if (!inputFile.good())
-    {
-        throw std::runtime_error("Failed to open input file");
-    }
-    Program_t program;
-    std::string line;
-    while (std::getline(inputFile, line))
-    {
-        if (line.empty())
-        {
-            continue;
-        }
-        program.push_back(ParseInstruction(line));
-    }
-    return program;
+    return {opcode, std::stoi(std::string(instruction.substr(argumentBeginPos)))};
 }
 
 } // namespace
 
-int main(const int argc, const char *const argv[])
+class PuzzleDay08Impl final
 {
-    std::cout << "==Day 08==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
-    int ret = 0;
-    try
+public:
+    explicit PuzzleDay08Impl(const std::string_view input)
     {
-        Program_t program;
-        if (argc < 2)
-        {
-            std::cout << "Using example input. Alternatively, you can pass the path to an input file as command line argument\n";
-            program.reserve(sizeof(aExampleInput) / sizeof(*aExampleInput));
-            for (const auto &line : aExampleInput)
+        ParseLines(input, [this](const std::string_view &line) {
+            if (!line.empty())
             {
                 program.push_back(ParseInstruction(line));
             }
-        }
-        else
+            return true;
+        });
+    }
+
+    [[nodiscard]] std::optional<int> AccumulatorBeforeFirstRepetition() const
+    {
+        int accumulator{0};
+        if (ExecuteProgram(program, accumulator))
         {
-            program = LoadProgramFile(argv[1u]);
+            // the program terminated, hence no instruction has been executed a second time
+            return std::nullopt;
         }
+        return accumulator;
+    }
 
-        std::cout << "Input parsing complete" << std::endl;
+    [[nodiscard]] std::optional<int> AccumulatorAfterFixedProgramTerminates() const
+    {
+        auto patchedProgram = program;
+        for (auto &instruction : patchedProgram)
         {
-            std::cout << "=Part 1=\n";
-            try
+            const Opcode originalOpcode = instruction.opcode;
+            switch (instruction.opcode)
             {
-                int accumulator{0};
-                if (!ExecuteProgram(program, accumulator))
-                {
-
-                    std::cout << "Immediately before any instruction is executed a second time, the value in the accumulator is "
-                              << accumulator << ".\n";
-                }
-                else
-                {
-                    return 1;
-                }
+                case Opcode::nop:
+                    instruction.opcode = Opcode::jmp;
+                    break;
+                case Opcode::jmp:
+                    instruction.opcode = Opcode::nop;
+                    break;
+                default:
+                    continue;
             }
-            catch (std::runtime_error &e)
+            int accumulator{0};
+            if (!ExecuteProgram(patchedProgram, accumulator))
             {
-                std::cerr << e.what();
-                ret = 1;
+                // fix has not worked, revert...
+                instruction.opcode = originalOpcode;
             }
-            catch (std::out_of_range &e)
+            else
             {
-                std::cerr << e.what();
-                ret = 1;
+                return accumulator;
             }
         }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] bool empty() const { return program.empty(); }
+
+private:
+    Program_t program;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(08)
+
+PuzzleDay08::PuzzleDay08(const std::string_view input)
+{
+    try
+    {
+        pImpl = std::make_unique<PuzzleDay08Impl>(input);
+    }
+    catch (const std::exception & /* e */)
+    {
+        pImpl.reset();
+    }
+}
+
+PuzzleDay08::~PuzzleDay08() = default;
+
+IPuzzle::Solution_t PuzzleDay08::Part1()
+{
+    if (!pImpl || pImpl->empty())
+    {
+        return std::monostate{};
+    }
+    try
+    {
+        const auto accumulator = pImpl->AccumulatorBeforeFirstRepetition();
+        if (accumulator.has_value())
         {
-            std::cout << "=Part 2=\n";
-            try
-            {
-                bool programHasBeenFixed = false;
-                for (auto &instruction : program)
-                {
-                    const Opcode originalOpcode = instruction.opcode;
-                    switch (instruction.opcode)
-                    {
-                        case Opcode::nop:
-                            instruction.opcode = Opcode::jmp;
-                            break;
-                        case Opcode::jmp:
-                            instruction.opcode = Opcode::nop;
-                            break;
-                        default:
-                            continue;
-                    }
-                    int accumulator{0};
-                    if (!ExecuteProgram(program, accumulator))
-                    {
-                        // fix has not worked, revert...
-                        instruction.opcode = originalOpcode;
-                    }
-                    else
-                    {
-                        std::cout << "After the program terminates, the value in the accumulator is " << accumulator << ".\n";
-                        programHasBeenFixed = true;
-                        break;
-                    }
-                }
-                if (!programHasBeenFixed)
-                {
-                    std::cerr << "Failed to fix the program\n";
-                    ret = 1;
-                }
-            }
-            catch (std::runtime_error &e)
-            {
-                std::cerr << e.what();
-                ret = 1;
-            }
-            catch (std::out_of_range &e)
-            {
-                std::cerr << e.what();
-                ret = 1;
-            }
+            return std::int64_t{accumulator.value()};
         }
     }
-    catch (const std::runtime_error &e)
+    catch (const std::exception & /* e */)
+    {
+    }
+    return std::monostate{};
+}
+
+IPuzzle::Solution_t PuzzleDay08::Part2()
+{
+    if (!pImpl || pImpl->empty())
+    {
+        return std::monostate{};
+    }
+    try
     {
-        std::cerr << e.what() << '\n';
-        return 1;
+        const auto accumulator = pImpl->AccumulatorAfterFixedProgramTerminates();
+        if (accumulator.has_value())
+        {
+            return std::int64_t{accumulator.value()};
+        }
     }
-    catch (...)
+    catch (const std::exception & /* e */)
     {
-        std::cerr << "Unknown error" << '\n';
-        return 1;
     }
-
-    return ret;
+    return std::monostate{};
 }
+
+} // namespace AOC::Y2020
@@ -1,20 +1,27 @@
+#include "NumberConversions.hpp"
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
 #include <iterator>
 #include <optional>
 #include <stdexcept>
-#include <string>
-#include <type_traits>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+namespace AOC::Y2020
+{
+
 namespace
 {
 
 using std::size_t;
 
+constexpr size_t defaultPreambleLength{25u};
+
 struct XMAS
 {
     using num_t = std::uint64_t;
@@ -76,25 +83,10 @@ struct XMAS
     }
 }
 
-size_t Day09_Part1(const XMAS &input)
-{
-    std::cout << "=Part 1=\n";
-    const auto invalidNumIndex = FindIndexOfFirstInvalidNumber(input);
-    const auto idx = invalidNumIndex.value_or(0);
-    if (!invalidNumIndex.has_value() || (idx >= input.sequence.size()))
-    {
-        std::cerr << "Failed to find an invalid number\n";
-        return 0;
-    }
-    std::cout << "Found first invalid number at index [" << idx << "]: " << input.sequence[idx] << "\n";
-    return idx;
-}
-
-int Day09_Part2(const XMAS &input, const size_t indexOfInvalidNum)
+[[nodiscard]] std::optional<XMAS::num_t> FindEncryptionWeakness(const XMAS &input, const size_t indexOfInvalidNum)
 {
-    std::cout << "=Part 2=\n";
     const auto &seq = input.sequence;
-    const auto itEnd = seq.begin() + indexOfInvalidNum;
+    const auto itEnd = seq.begin() + static_cast<std::ptrdiff_t>(indexOfInvalidNum);
     const auto invalidNum{*itEnd};
     for (auto it1 = seq.begin(); it1 < itEnd; it1++)
     {
@@ -106,94 +98,83 @@ int Day09_Part2(const XMAS &input, const size_t indexOfInvalidNum)
             {
                 if (sum == invalidNum)
                 {
-                    const auto rangStartIndex = std::distance(seq.begin(), it1);
-                    const auto rangeEndIndex = std::distance(seq.begin(), it2);
-                    std::cout << "Contiguous range from [" << rangStartIndex << "] = " << *it1 << " to [" << rangeEndIndex
-                              << "] = " << *it2 << "\n";
                     const auto rangeMin = *std::min_element(it1, it2 + 1);
                     const auto rangeMax = *std::max_element(it1, it2 + 1);
-                    std::cout << "Min element in that range is " << rangeMin << ", max element in that range is " << rangeMax
-                              << "\n";
-                    std::cout << "Encryption weakness: " << rangeMin + rangeMax << "\n";
+                    return rangeMin + rangeMax;
                 }
                 break;
             }
         }
     }
-    return 1;
+    return std::nullopt;
 }
 
-[[nodiscard]] XMAS LoadDataFromFile(const char *const filename)
+[[nodiscard]] XMAS ParseInput(const std::string_view input, const size_t preambleLength)
 {
-    if (nullptr == filename)
-    {
-        throw std::runtime_error("Filename is NULL");
-    }
-    std::ifstream inputFile(filename, std::ifstream::in);
-    if (!inputFile.good())
-    {
-        throw std::runtime_error("Failed to open input file");
-    }
     std::vector<XMAS::num_t> sequence;
-    std::string line;
-    while (std::getline(inputFile, line))
-    {
+    const bool parsed = ParseLines(input, [&sequence](const std::string_view &line) {
         if (line.empty())
         {
-            continue;
+            return true;
+        }
+        XMAS::num_t parsedValue{};
+        if (!ReadFromSv(parsedValue, line, 0u, line.size()))
+        {
+            return false;
         }
-        const auto parsedValue = std::stoull(line);
         sequence.push_back(parsedValue);
-        static_assert(std::numeric_limits<decltype(sequence)::value_type>::max() >= std::numeric_limits<decltype(parsedValue)>::max(), "");
+        return true;
+    });
+    if (!parsed)
+    {
+        sequence.clear();
     }
-    return {25, sequence};
+    return {preambleLength, sequence};
 }
 
 } // namespace
 
-int main(const int argc, const char *const argv[])
+class PuzzleDay09Impl final
 {
-    std::cout << "==Day 09==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
-    int ret = 0;
-    try
+public:
+    explicit PuzzleDay09Impl(const std::string_view input, const size_t preambleLength = defaultPreambleLength)
+        : input(ParseInput(input, preambleLength))
     {
-        const XMAS input = [&]() -> XMAS {
-            if (argc < 2)
-            {
-                std::cout
-                    << "Using example input. Alternatively, you can pass the path to an input file as command line argument\n";
-                return {
-                    5,
-                    {
-                        35, 20, 15, 25, 47, 40, 62, 55, 65, 95, 102, 117, 150, 182, 127, 219, 299, 277, 309, 576,
-                    },
-                };
-            }
-            else
-            {
-                return LoadDataFromFile(argv[1u]);
-            }
-        }();
-        const auto invalidIdx = Day09_Part1(input);
-        if (0 == invalidIdx)
-        {
-            return 1;
-        }
-        ret = Day09_Part2(input, invalidIdx);
     }
-    catch (std::runtime_error &e)
+
+public:
+    const XMAS input;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(09)
+
+PuzzleDay09::PuzzleDay09(const std::string_view input) : pImpl(std::make_unique<PuzzleDay09Impl>(input)) {}
+
+PuzzleDay09::~PuzzleDay09() = default;
+
+IPuzzle::Solution_t PuzzleDay09::Part1()
+{
+    const auto invalidNumIndex = FindIndexOfFirstInvalidNumber(pImpl->input);
+    if (!invalidNumIndex.has_value())
     {
-        std::cerr << e.what() << '\n';
-        return 1;
+        return std::monostate{};
     }
-    catch (...)
+    return static_cast<std::int64_t>(pImpl->input.sequence[invalidNumIndex.value()]);
+}
+
+IPuzzle::Solution_t PuzzleDay09::Part2()
+{
+    const auto invalidNumIndex = FindIndexOfFirstInvalidNumber(pImpl->input);
+    if (!invalidNumIndex.has_value())
     {
-        std::cerr << "Failed to load data\n";
-        return 1;
+        return std::monostate{};
     }
-
-    return ret;
+    const auto encryptionWeakness = FindEncryptionWeakness(pImpl->input, invalidNumIndex.value());
+    if (!encryptionWeakness.has_value())
+    {
+        return std::monostate{};
+    }
+    return static_cast<std::int64_t>(encryptionWeakness.value());
 }
+
+} // namespace AOC::Y2020
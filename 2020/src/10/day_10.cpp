@@ -1,19 +1,18 @@
-#include <algorithm>
+#include "NumberConversions.hpp"
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
-#include <iterator>
 #include <numeric>
+#include <optional>
 #include <set>
-#include <stdexcept>
-#include <string>
+#include <string_view>
 #include <type_traits>
-#include <variant>
-#include <vector>
 
-#include "fileUtils.hpp"
+namespace AOC::Y2020
+{
 
 namespace
 {
@@ -22,10 +21,9 @@ using Joltage = std::uint32_t;
 constexpr Joltage outletJoltage{0u};
 constexpr Joltage maxJoltageStep{3u};
 
-int Day010_Part1(const std::set<Joltage> &input)
+std::optional<std::uint64_t> MultiplyOneAndThreeJoltSteps(const std::set<Joltage> &input)
 {
-    std::cout << "=Part 1=\n";
-    std::array<Joltage, maxJoltageStep + 1u> joltageSteps{};
+    std::array<std::uint64_t, maxJoltageStep + 1u> joltageSteps{};
     Joltage previous{outletJoltage};
     for (const auto &adapter : input)
     {
@@ -33,22 +31,19 @@ int Day010_Part1(const std::set<Joltage> &input)
         previous = adapter;
         if (diff >= joltageSteps.size())
         {
-            std::cerr << "No adapter chain found\n";
-            return 1;
+            // no adapter chain found
+            return std::nullopt;
         }
         joltageSteps[diff]++;
     }
 
     joltageSteps[3u]++; // take internal joltage adapter into account
 
-    std::cout << "1-jolt steps: " << joltageSteps[1u] << ", 3-jolt steps: " << joltageSteps[3u] << "\n";
-    std::cout << "Product of 1-jolt and 3-jolt steps: " << joltageSteps[1u] * joltageSteps[3u] << "\n";
-    return 0;
+    return joltageSteps[1u] * joltageSteps[3u];
 }
 
-int Day010_Part2(const std::set<Joltage> &input)
+std::uint64_t CountArrangements(const std::set<Joltage> &input)
 {
-    std::cout << "=Part 2=\n";
     std::array<std::uint64_t, maxJoltageStep> arrangements = {1u};
     constexpr std::decay<decltype(arrangements[0u])>::type initalAccumulator{0u};
     const auto lastAdapterJoltage = *input.rbegin();
@@ -63,44 +58,66 @@ int Day010_Part2(const std::set<Joltage> &input)
         }
         arrangements[position] = std::accumulate(arrangements.begin(), arrangements.end(), initalAccumulator);
     }
-    const auto totalArrangements = std::accumulate(arrangements.begin(), arrangements.end(), initalAccumulator);
-    std::cout << "Total number of distinct ways we can arrange the adapters: " << totalArrangements << "\n";
-    return 0;
+    return std::accumulate(arrangements.begin(), arrangements.end(), initalAccumulator);
 }
 
 } // namespace
 
-int main(const int argc, const char *const argv[])
+class PuzzleDay10Impl final
 {
-    std::cout << "==Day 10==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
-    auto input = [&]() -> std::vector<Joltage> {
-        if (argc > 1)
-        {
-            auto inputVariant = ParseInputFile<Joltage>(argv[1u]);
-            if (std::holds_alternative<std::vector<Joltage>>(inputVariant))
+public:
+    explicit PuzzleDay10Impl(const std::string_view input)
+    {
+        const bool parsed = ParseLines(input, [this](const std::string_view &line) {
+            if (line.empty())
+            {
+                return true;
+            }
+            Joltage adapter{};
+            if (!ReadFromSv(adapter, line, 0u, line.size()))
             {
-                return std::get<std::vector<Joltage>>(inputVariant);
+                return false;
             }
-            std::cerr << "Failed to open or parse input file";
+            sortedInput.insert(adapter);
+            return true;
+        });
+        if (!parsed)
+        {
+            sortedInput.clear();
         }
-        std::cout << "Using example input\n";
-        return {
-            28, 33, 18, 42, 31, 14, 46, 20, 48, 47, 24, 23, 49, 45, 19, 38, 39, 11, 1, 32, 25, 35, 8, 17, 7, 9, 4, 2, 34, 10, 3,
-        };
-    }();
+    }
+
+public:
     std::set<Joltage> sortedInput;
-    for (const auto &i : input)
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(10)
+
+PuzzleDay10::PuzzleDay10(const std::string_view input) : pImpl(std::make_unique<PuzzleDay10Impl>(input)) {}
+
+PuzzleDay10::~PuzzleDay10() = default;
+
+IPuzzle::Solution_t PuzzleDay10::Part1()
+{
+    if (pImpl->sortedInput.empty())
     {
-        sortedInput.insert(i);
+        return std::monostate{};
     }
+    const auto result = MultiplyOneAndThreeJoltSteps(pImpl->sortedInput);
+    if (!result.has_value())
+    {
+        return std::monostate{};
+    }
+    return static_cast<std::int64_t>(result.value());
+}
 
-    int ret = Day010_Part1(sortedInput);
-    if (ret == 0)
+IPuzzle::Solution_t PuzzleDay10::Part2()
+{
+    if (pImpl->sortedInput.empty())
     {
-        ret = Day010_Part2(sortedInput);
+        return std::monostate{};
     }
-    return ret;
+    return static_cast<std::int64_t>(CountArrangements(pImpl->sortedInput));
 }
+
+} // namespace AOC::Y2020
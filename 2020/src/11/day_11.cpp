@@ -1,17 +1,17 @@
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
 
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
-#include <iterator>
-#include <string>
+#include <stdexcept>
 #include <string_view>
-#include <variant>
+#include <type_traits>
 #include <vector>
 
-#include "fileUtils.hpp"
+namespace AOC::Y2020
+{
 
 namespace
 {
@@ -19,11 +19,6 @@ namespace
 using std::int8_t;
 using std::size_t;
 
-constexpr std::string_view exampleInput[]{
-    "L.LL.LL.LL", "LLLLLLL.LL", "L.L.L..L..", "LLLL.LL.LL", "L.LL.LL.LL",
-    "L.LLLLL.LL", "..L.L.....", "LLLLLLLLLL", "L.LLLLLL.L", "L.LLLLL.LL",
-};
-
 #define AOC_POSITION_TYPE_LIST(_X_) _X_(floor, ".") _X_(emptySeat, "L") _X_(occupiedSeat, "#")
 
 enum class GridElement : char
@@ -165,74 +160,23 @@ struct Grid
     {
         return static_cast<unsigned int>(std::count(elems.begin(), elems.end(), state));
     }
-
-    void Print() const
-    {
-        const auto end = elems.size();
-        for (size_t i = 0; i < end; i++)
-        {
-            if (i % width == 0)
-            {
-                std::cout << '\n';
-            }
-            std::cout << static_cast<char>(elems[i]);
-        }
-        std::cout << "\n\n";
-    }
 };
 
-int Day11_Part1(const Grid &input)
-{
-    std::cout << "=Part 1=\n";
-    Grid inputCopy{input};
-    constexpr size_t occupancyTreshold{4u};
-    constexpr Grid::SearchMode countAdjacent{Grid::SearchMode::adjacent};
-    do
-    {
-#if !defined(NDEBUG)
-        static int iteration{0u};
-        std::cout << "Iteration " << ++iteration << "\n";
-        // inputCopy.Print();
-#endif
-    } while (inputCopy.RunSimulationStep(occupancyTreshold, countAdjacent));
-    const auto occupiedCnt = inputCopy.CountSeatsOfState(GridElement::occupiedSeat);
-    std::cout << "In the stable state, " << occupiedCnt << " seats are occupied.\n";
-
-    return 0;
-}
-
-int Day11_Part2(const Grid &input)
-{
-    std::cout << "=Part 2=\n";
-    Grid inputCopy{input};
-    constexpr size_t occupancyTreshold{5u};
-    constexpr Grid::SearchMode countFirstSeatInAnyDirection{Grid::SearchMode::firstInAnyDirection};
-    do
-    {
-#if !defined(NDEBUG)
-        static int iteration{0u};
-        std::cout << "Iteration " << ++iteration << "\n";
-        // inputCopy.Print();
-#endif
-    } while (inputCopy.RunSimulationStep(occupancyTreshold, countFirstSeatInAnyDirection));
-    const auto occupiedCnt = inputCopy.CountSeatsOfState(GridElement::occupiedSeat);
-    std::cout << "In the stable state, " << occupiedCnt << " seats are occupied.\n";
-
-    return 0;
-}
-
-[[nodiscard]] Grid ParseRawInput(const std::vector<std::string> &rawInput)
+[[nodiscard]] Grid ParseInput(const std::string_view input)
 {
     Grid g;
-    for (const auto &line : rawInput)
-    {
+    ParseLines(input, [&g](const std::string_view &line) {
+        if (line.empty())
+        {
+            return true;
+        }
         if (g.width == 0)
         {
             g.width = line.size();
         }
         else if (g.width != line.size())
         {
-            throw;
+            throw std::runtime_error("Inconsistent row width");
         }
         for (const auto &c : line)
         {
@@ -243,62 +187,71 @@ int Day11_Part2(const Grid &input)
         g.elems.push_back(GridElement::name);                                                                                    \
         break;
                 AOC_POSITION_TYPE_LIST(AOC_POSITION_TYPE_PARSER_CASE)
+#undef AOC_POSITION_TYPE_PARSER_CASE
 
                 default:
-                    throw;
+                    throw std::runtime_error("Invalid grid element");
             }
         }
-    }
+        return true;
+    });
     return g;
 }
 
+std::int64_t SimulateUntilStable(const Grid &input, const size_t occupancyThreshold, const Grid::SearchMode searchMode)
+{
+    Grid inputCopy{input};
+    while (inputCopy.RunSimulationStep(occupancyThreshold, searchMode))
+    {
+    }
+    return inputCopy.CountSeatsOfState(GridElement::occupiedSeat);
+}
+
 } // namespace
 
-int main(const int argc, const char *const argv[])
+class PuzzleDay11Impl final
+{
+public:
+    explicit PuzzleDay11Impl(const std::string_view input) : grid(ParseInput(input)) {}
+
+public:
+    const Grid grid;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(11)
+
+PuzzleDay11::PuzzleDay11(const std::string_view input)
 {
-    std::cout << "==Day 11==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
     try
     {
-        const auto rawInput = [&]() -> std::vector<std::string> {
-            std::vector<std::string> lines;
-            if (argc > 1)
-            {
-                auto inputVariant = OpenFile(argv[1u]);
-                if (std::holds_alternative<std::ifstream>(inputVariant))
-                {
-                    auto &file = std::get<std::ifstream>(inputVariant);
-                    std::string line;
-                    while (std::getline(file, line))
-                    {
-                        lines.push_back(line);
-                    }
-                    return lines;
-                }
-                std::cerr << "Failed to open or parse input file";
-            }
-            std::cout << "Using example input\n";
-            for (const auto &line : exampleInput)
-            {
-                lines.emplace_back(line);
-            }
-            return lines;
-        }();
+        pImpl = std::make_unique<PuzzleDay11Impl>(input);
+    }
+    catch (const std::exception & /* e */)
+    {
+        pImpl.reset();
+    }
+}
 
-        const auto input = ParseRawInput(rawInput);
+PuzzleDay11::~PuzzleDay11() = default;
 
-        int ret = Day11_Part1(input);
-        if (ret == 0)
-        {
-            ret = Day11_Part2(input);
-        }
-        return ret;
+IPuzzle::Solution_t PuzzleDay11::Part1()
+{
+    if (!pImpl || pImpl->grid.elems.empty())
+    {
+        return std::monostate{};
     }
-    catch (...)
+    constexpr size_t occupancyTreshold{4u};
+    return SimulateUntilStable(pImpl->grid, occupancyTreshold, Grid::SearchMode::adjacent);
+}
+
+IPuzzle::Solution_t PuzzleDay11::Part2()
+{
+    if (!pImpl || pImpl->grid.elems.empty())
     {
-        std::cerr << "Failed to read or parse input\n";
-        return 1;
+        return std::monostate{};
     }
+    constexpr size_t occupancyTreshold{5u};
+    return SimulateUntilStable(pImpl->grid, occupancyTreshold, Grid::SearchMode::firstInAnyDirection);
 }
+
+} // namespace AOC::Y2020
@@ -1,26 +1,22 @@
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
 
-#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
-#include <iterator>
 #include <string>
 #include <string_view>
-#include <variant>
 #include <vector>
 
-#include "fileUtils.hpp"
+namespace AOC::Y2020
+{
 
 namespace
 {
 
 using std::size_t;
 
-constexpr const char *aExampleInput[] = {"F10", "N3", "F7", "R90", "F11"};
-
 enum class Direction
 {
     North,
@@ -302,99 +298,69 @@ private:
     Position2D m_waypoint;
 };
 
-int Day12_Part1(const std::vector<std::string> &input)
-{
-    std::cout << "=Part 1=\n";
-    constexpr Position2D startPos{0, 0};
-    Ship ship(Direction::East, startPos);
-    for (const auto &instruction : input)
-    {
-        if (!ship.Navigate(instruction))
-        {
-            std::cerr << "Failed to parse navigation instruction";
-#if !defined(NDEBUG)
-            std::cerr << ": " << instruction;
-#endif
-            std::cerr << "\n";
-            return 1;
-        }
-    }
-    std::cout << "Manhattan distance to the start postion: " << ship.GetPositon().ManhattanDistanceTo(startPos) << "\n";
-    return 0;
-}
-
-int Day12_Part2(const std::vector<std::string> &input)
+[[nodiscard]] std::int64_t NavigateAndMeasureDistance(Ship ship, const Position2D &startPos,
+                                                      const std::vector<std::string> &instructions)
 {
-    std::cout << "=Part 2=\n";
-    constexpr Position2D startPos{0, 0};
-    constexpr int waypointInitalOffsetEast{10};
-    constexpr int waypointInitalOffsetNorth{1};
-    constexpr Position2D firstWaypoint{startPos.east + waypointInitalOffsetEast, startPos.north + waypointInitalOffsetNorth};
-    Ship ship(startPos, firstWaypoint);
-    for (const auto &instruction : input)
+    for (const auto &instruction : instructions)
     {
         if (!ship.Navigate(instruction))
         {
-            std::cerr << "Failed to parse navigation instruction";
-#if !defined(NDEBUG)
-            std::cerr << ": " << instruction;
-#endif
-            std::cerr << "\n";
-            return 1;
+            // failed to parse navigation instruction
+            return -1;
         }
     }
-    std::cout << "Manhattan distance to the start postion: " << ship.GetPositon().ManhattanDistanceTo(startPos) << "\n";
-    return 0;
+    return ship.GetPositon().ManhattanDistanceTo(startPos);
 }
 
 } // namespace
 
-int main(const int argc, const char *const argv[])
+class PuzzleDay12Impl final
 {
-    std::cout << "==Day 12==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
-    try
+public:
+    explicit PuzzleDay12Impl(const std::string_view input)
     {
-        const auto rawInput = [&]() -> std::vector<std::string> {
-            std::vector<std::string> lines;
-            if (argc > 1)
-            {
-                auto inputVariant = OpenFile(argv[1u]);
-                if (std::holds_alternative<std::ifstream>(inputVariant))
-                {
-                    auto &file = std::get<std::ifstream>(inputVariant);
-                    std::string line;
-                    while (std::getline(file, line))
-                    {
-                        if (!line.empty())
-                        {
-                            lines.push_back(line);
-                        }
-                    }
-                    return lines;
-                }
-                std::cerr << "Failed to open or parse input file";
-            }
-            std::cout << "Using example input\n";
-            for (const auto &line : aExampleInput)
+        ParseLines(input, [this](const std::string_view &line) {
+            if (!line.empty())
             {
-                lines.emplace_back(line);
+                instructions.emplace_back(line);
             }
-            return lines;
-        }();
+            return true;
+        });
+    }
 
-        int ret = Day12_Part1(rawInput);
-        if (ret == 0)
-        {
-            ret = Day12_Part2(rawInput);
-        }
-        return ret;
+public:
+    std::vector<std::string> instructions;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(12)
+
+PuzzleDay12::PuzzleDay12(const std::string_view input) : pImpl(std::make_unique<PuzzleDay12Impl>(input)) {}
+
+PuzzleDay12::~PuzzleDay12() = default;
+
+IPuzzle::Solution_t PuzzleDay12::Part1()
+{
+    constexpr Position2D startPos{0, 0};
+    const auto distance = NavigateAndMeasureDistance(Ship(Direction::East, startPos), startPos, pImpl->instructions);
+    if (pImpl->instructions.empty() || (distance < 0))
+    {
+        return std::monostate{};
     }
-    catch (...)
+    return distance;
+}
+
+IPuzzle::Solution_t PuzzleDay12::Part2()
+{
+    constexpr Position2D startPos{0, 0};
+    constexpr int waypointInitalOffsetEast{10};
+    constexpr int waypointInitalOffsetNorth{1};
+    constexpr Position2D firstWaypoint{startPos.east + waypointInitalOffsetEast, startPos.north + waypointInitalOffsetNorth};
+    const auto distance = NavigateAndMeasureDistance(Ship(startPos, firstWaypoint), startPos, pImpl->instructions);
+    if (pImpl->instructions.empty() || (distance < 0))
     {
-        std::cerr << "Failed to read or parse input\n";
-        return 1;
+        return std::monostate{};
     }
+    return distance;
 }
+
+} // namespace AOC::Y2020
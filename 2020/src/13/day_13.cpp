@@ -1,27 +1,23 @@
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
 
-#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
-#include <iterator>
 #include <limits>
 #include <string>
 #include <string_view>
-#include <variant>
 #include <vector>
 
-#include "fileUtils.hpp"
+namespace AOC::Y2020
+{
 
 namespace
 {
 
 using std::size_t;
 
-constexpr const char *aExampleInput[] = {"939", "7,13,x,x,59,x,31,19"};
-
 struct BusSchedule
 {
 public:
@@ -121,81 +117,78 @@ private:
     const std::vector<int> m_busIds;
 };
 
-int Day13_Part1(const std::array<std::string, 2u> &input)
+} // namespace
+
+class PuzzleDay13Impl final
 {
-    std::cout << "=Part 1=\n";
-    BusSchedule schedule{input[1u]};
-    const auto nextDeparture = schedule.FindNextDeparture(input[0u]);
-    if (nextDeparture.busId == 0)
+public:
+    explicit PuzzleDay13Impl(const std::string_view input)
     {
-        std::cerr << "Failed to find earliest departure\n";
-        return 1;
+        size_t lineCnt{0u};
+        ParseLines(input, [this, &lineCnt](const std::string_view &line) {
+            if (lineCnt >= lines.size())
+            {
+                return false;
+            }
+            lines[lineCnt++] = line;
+            return true;
+        });
+        valid = (lineCnt == lines.size()) && !lines[0u].empty() && !lines[1u].empty();
     }
-    std::cout << "Bus " << nextDeparture.busId << " departs in " << nextDeparture.waitTime << " minute"
-              << ((nextDeparture.waitTime == 1) ? ".\n" : "s.\n");
-    std::cout << "Product: " << nextDeparture.waitTime * nextDeparture.busId << "\n";
-    return 0;
-}
 
-int Day13_Part2(const std::array<std::string, 2u> &input)
+public:
+    std::array<std::string, 2u> lines;
+    bool valid{false};
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(13)
+
+PuzzleDay13::PuzzleDay13(const std::string_view input) : pImpl(std::make_unique<PuzzleDay13Impl>(input)) {}
+
+PuzzleDay13::~PuzzleDay13() = default;
+
+IPuzzle::Solution_t PuzzleDay13::Part1()
 {
-    std::cout << "=Part 2=\n";
-    BusSchedule schedule{input[1u]};
-    const auto earliestSubsequentDepartures = schedule.FindEarliestSubsequentDepartures();
-    if (0 == earliestSubsequentDepartures)
+    if (!pImpl->valid)
+    {
+        return std::monostate{};
+    }
+    try
+    {
+        BusSchedule schedule{pImpl->lines[1u]};
+        const auto nextDeparture = schedule.FindNextDeparture(pImpl->lines[0u]);
+        if (nextDeparture.busId == 0)
+        {
+            return std::monostate{};
+        }
+        return std::int64_t{nextDeparture.waitTime} * nextDeparture.busId;
+    }
+    catch (const std::exception & /* e */)
     {
-        std::cerr << "Could not find a timestamp such that all buses depart at subsequent minutes.\n";
+        return std::monostate{};
     }
-    std::cout << "Earliest timestaps such that all buses depart at an offset matching their positions: "
-              << earliestSubsequentDepartures << "\n";
-    static_cast<void>(input);
-    return 0;
 }
 
-} // namespace
-
-int main(const int argc, const char *const argv[])
+IPuzzle::Solution_t PuzzleDay13::Part2()
 {
-    std::cout << "==Day 13==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
+    if (!pImpl->valid)
+    {
+        return std::monostate{};
+    }
     try
     {
-        const std::array<std::string, 2u> rawInput = [&]() -> std::array<std::string, 2u> {
-            std::array<std::string, 2u> lines;
-            if (argc > 1)
-            {
-                auto inputVariant = OpenFile(argv[1u]);
-                if (std::holds_alternative<std::ifstream>(inputVariant))
-                {
-                    auto &file = std::get<std::ifstream>(inputVariant);
-                    std::string line;
-                    size_t lineCnt{0u};
-                    while (std::getline(file, line) && (lineCnt < lines.size()))
-                    {
-                        lines[lineCnt++] = line;
-                    }
-                    return lines;
-                }
-                std::cerr << "Failed to open or parse input file";
-            }
-            std::cout << "Using example input\n";
-            lines[0u] = aExampleInput[0u];
-            lines[1u] = aExampleInput[1u];
-            return lines;
-        }();
-
-        int ret = Day13_Part1(rawInput);
-        if (ret == 0)
+        BusSchedule schedule{pImpl->lines[1u]};
+        const auto earliestSubsequentDepartures = schedule.FindEarliestSubsequentDepartures();
+        if (0 == earliestSubsequentDepartures)
         {
-            ret = Day13_Part2(rawInput);
+            return std::monostate{};
         }
-        return ret;
+        return static_cast<std::int64_t>(earliestSubsequentDepartures);
     }
-    catch (...)
+    catch (const std::exception & /* e */)
     {
-        std::cerr << "Failed to read or parse input\n";
-        return 1;
+        return std::monostate{};
     }
 }
+
+} // namespace AOC::Y2020
@@ -1,19 +1,15 @@
-#include <array>
-#include <cassert>
+#include "NumberConversions.hpp"
+#include "puzzle_common.hpp"
+#include "stringUtils.hpp"
+
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
-#include <limits>
 #include <map>
 #include <numeric>
-#include <string>
 #include <string_view>
-#include <variant>
-#include <vector>
 
-#include "NumberConversions.hpp"
-#include "fileUtils.hpp"
+namespace AOC::Y2020
+{
 
 namespace
 {
@@ -21,20 +17,6 @@ namespace
 using std::size_t;
 using std::uint64_t;
 
-constexpr std::string_view aExampleInput1[] = {
-    "mask = XXXXXXXXXXXXXXXXXXXXXXXXXXXXX1XXXX0X",
-    "mem[8] = 11",
-    "mem[7] = 101",
-    "mem[8] = 0",
-};
-
-constexpr std::string_view aExampleInput2[] = {
-    "mask = 000000000000000000000000000000X1001X",
-    "mem[42] = 100",
-    "mask = 00000000000000000000000000000000X0XX",
-    "mem[26] = 1",
-};
-
 class Decoder
 {
 public:
@@ -176,88 +158,45 @@ public:
     }
 };
 
-int Day14_Part1(const std::vector<std::string> &input)
+template <typename DecoderT>
+[[nodiscard]] IPuzzle::Solution_t RunProgram(const std::string_view &input)
 {
-    std::cout << "=Part 1=\n";
-    Decoder1 computer;
-    for (const auto &line : input)
+    DecoderT computer;
+    const bool success = ParseLines(input, [&computer](const std::string_view &line) {
+        return (line.empty() || computer.ProcessProgramLine(line));
+    });
+    if (!success)
     {
-        if (!computer.ProcessProgramLine(line))
-        {
-            return 1;
-        }
+        return std::monostate{};
     }
-    const auto memSum = computer.CalculateMemorySum();
-    std::cout << "Sum of all values left in memory: " << memSum << "\n";
-    return 0;
+    return static_cast<std::int64_t>(computer.CalculateMemorySum());
 }
 
-int Day14_Part2(const std::vector<std::string> &input)
+} // namespace
+
+class PuzzleDay14Impl final
 {
-    std::cout << "=Part 1=\n";
-    Decoder2 computer;
-    for (const auto &line : input)
-    {
-        if (!computer.ProcessProgramLine(line))
-        {
-            return 1;
-        }
-    }
-    const auto memSum = computer.CalculateMemorySum();
-    std::cout << "Sum of all values left in memory: " << memSum << "\n";
-    return 0;
-}
+public:
+    explicit PuzzleDay14Impl(const std::string_view input) : program(input) {}
 
-} // namespace
+public:
+    const std::string program;
+};
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(14)
 
-int main(const int argc, const char *const argv[])
+PuzzleDay14::PuzzleDay14(const std::string_view input) : pImpl(std::make_unique<PuzzleDay14Impl>(input)) {}
+
+PuzzleDay14::~PuzzleDay14() = default;
+
+IPuzzle::Solution_t PuzzleDay14::Part1()
 {
-    std::cout << "==Day 14==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
-    try
-    {
-        const std::array<std::vector<std::string>, 2> rawInput = [&]() -> std::array<std::vector<std::string>, 2> {
-            std::array<std::vector<std::string>, 2> input;
-            if (argc > 1)
-            {
-                auto inputVariant = OpenFile(argv[1u]);
-                if (std::holds_alternative<std::ifstream>(inputVariant))
-                {
-                    auto &file = std::get<std::ifstream>(inputVariant);
-                    std::string line;
-                    while (std::getline(file, line))
-                    {
-                        input[0].push_back(line);
-                    }
-                    input[1] = input[0];
-                    return input;
-                }
-                std::cerr << "Failed to open or parse input file";
-            }
-            std::cout << "Using example input\n";
-            for (const auto &line : aExampleInput1)
-            {
-                input[0].emplace_back(line);
-            }
-            for (const auto &line : aExampleInput2)
-            {
-                input[1].emplace_back(line);
-            }
-            return input;
-        }();
+    return RunProgram<Decoder1>(pImpl->program);
+}
 
-        int ret = Day14_Part1(rawInput[0]);
-        if (ret == 0)
-        {
-            ret = Day14_Part2(rawInput[1]);
-        }
-        return ret;
-    }
-    catch (...)
-    {
-        std::cerr << "Failed to read or parse input\n";
-        return 1;
-    }
+IPuzzle::Solution_t PuzzleDay14::Part2()
+{
+    return RunProgram<Decoder2>(pImpl->program);
 }
+
+} // namespace AOC::Y2020
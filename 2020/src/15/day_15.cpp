@@ -1,185 +1,126 @@
-#include <algorithm>
-#include <array>
-#include <cassert>
+#include "NumberConversions.hpp"
+#include "puzzle_common.hpp"
+
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
-#include <limits>
-#include <map>
-#include <numeric>
 #include <string>
 #include <string_view>
 #include <utility>
-#include <variant>
 #include <vector>
 
-
-#include "NumberConversions.hpp"
-#include "fileUtils.hpp"
+namespace AOC::Y2020
+{
 
 namespace
 {
 
 using std::size_t;
-using std::uint64_t;
-
-constexpr std::string_view aExampleInput[] = {
-    "0,3,6", "1,3,2", "2,1,3", "1,2,3", "2,3,1", "3,2,1", "3,1,2",
-};
 
 class MemoryGame
 {
 public:
-    MemoryGame(const std::string_view &startingNumbers)
+    /// The turn in which a number has been spoken the last time is stored in a vector indexed by the number.
+    /// A spoken number is never greater than the number of turns played, so this is sized by lastTurn up-front
+    /// instead of searching an ordered map for the most recent turn on every call of SpeakNumber().
+    /// Starting numbers beyond lastTurn are never spoken and therefore not read.
+    MemoryGame(const std::string_view &startingNumbers, const unsigned int lastTurn) : m_turnOfNumber(lastTurn + 1u, 0u)
     {
-        unsigned int turn{1};
         for (size_t startPos = 0; startPos < startingNumbers.size();)
         {
-            auto endPos = startingNumbers.find(',', startPos);
+            auto endPos = startingNumbers.find_first_of(",\r\n", startPos);
             if (endPos > startingNumbers.size())
             {
                 endPos = startingNumbers.size();
             }
             unsigned int number{0};
-            if (!AOC::ReadFromSv(number, startingNumbers, startPos, endPos))
+            if (!ReadFromSv(number, startingNumbers, startPos, endPos) || (endPos == startPos))
+            {
+                break;
+            }
+            if (number >= m_turnOfNumber.size())
+            {
+                m_turnOfNumber.resize(number + 1u, 0u);
+            }
+            if (m_turn > 0u)
+            {
+                m_turnOfNumber[m_lastSpokenNumber] = m_turn;
+            }
+            m_turn++;
+            m_lastSpokenNumber = number;
+            if ((m_turn == lastTurn) || (endPos == startingNumbers.size()) || (startingNumbers[endPos] != ','))
             {
                 break;
             }
-            m_numsAndTurns[number] = turn++;
             startPos = endPos + 1;
         }
-        m_startSequenceLen = m_numsAndTurns.size();
     }
 
     std::pair<unsigned int, unsigned int> SpeakNumber()
     {
-        const auto itMaxTurn = std::max_element(m_numsAndTurns.begin(), m_numsAndTurns.end(),
-                                                [](const auto &p1, const auto &p2) { return (p1.second < p2.second); });
-        const auto maxTurn = itMaxTurn->second;
-        const auto turn = maxTurn + 1;
-
-        unsigned int numberSpokenThisTurn;
-        if (m_FirstOccurance)
+        const auto prevTurnOfNumber = m_turnOfNumber[m_lastSpokenNumber];
+        const unsigned int numberSpokenThisTurn = (prevTurnOfNumber == 0u) ? 0u : (m_turn - prevTurnOfNumber);
+        m_turnOfNumber[m_lastSpokenNumber] = m_turn;
+        m_turn++;
+        if (numberSpokenThisTurn >= m_turnOfNumber.size())
         {
-            numberSpokenThisTurn = 0u;
+            m_turnOfNumber.resize(numberSpokenThisTurn + 1u, 0u);
         }
-        else
-        {
-            numberSpokenThisTurn = (turn - 1) - m_prevTurnOfNumber;
-        }
-
-        const auto numIt = m_numsAndTurns.find(numberSpokenThisTurn);
-        const bool newNumberHasBeenSpokenBefore = (numIt != m_numsAndTurns.end());
-        if (newNumberHasBeenSpokenBefore)
-        {
-            m_prevTurnOfNumber = numIt->second;
-            m_FirstOccurance = false;
-        }
-        else
-        {
-            m_FirstOccurance = true;
-        }
-        m_numsAndTurns[numberSpokenThisTurn] = turn;
+        m_lastSpokenNumber = numberSpokenThisTurn;
 
-        return {turn, numberSpokenThisTurn};
+        return {m_turn, numberSpokenThisTurn};
     }
 
+    [[nodiscard]] unsigned int GetTurn() const { return m_turn; }
+
+    [[nodiscard]] unsigned int GetLastSpokenNumber() const { return m_lastSpokenNumber; }
+
 private:
-    std::map<unsigned int, unsigned int> m_numsAndTurns;
-    size_t m_startSequenceLen{};
-    unsigned int m_prevTurnOfNumber{};
-    bool m_FirstOccurance = true;
+    std::vector<unsigned int> m_turnOfNumber;
+    unsigned int m_turn{0u};
+    unsigned int m_lastSpokenNumber{0u};
 };
 
-int Day15_Part1(const std::string_view &input)
+[[nodiscard]] IPuzzle::Solution_t PlayMemoryGame(const std::string_view &startingNumbers, const unsigned int turnOfInterest)
 {
-    std::cout << "=Part 1=\n";
-    MemoryGame game{input};
-    while (true)
+    MemoryGame game{startingNumbers, turnOfInterest};
+    if (game.GetTurn() == 0u)
     {
-        const auto [turn, spokenNumber] = game.SpeakNumber();
-        constexpr unsigned int turnOfInterest{2020};
-        if (turn == turnOfInterest)
-        {
-            std::cout << "Number spoken in turn #" << turn << ": " << spokenNumber << "\n";
-            return 0;
-        }
+        return std::monostate{};
     }
-
-    return 0;
-}
-
-int Day15_Part2(const std::string_view &input)
-{
-    std::cout << "=Part 2=\n";
-    MemoryGame game{input};
-    while (true)
+    while (game.GetTurn() < turnOfInterest)
     {
-        const auto [turn, spokenNumber] = game.SpeakNumber();
-        constexpr unsigned int turnOfInterest{30'000'000};
-        if (turn == turnOfInterest)
-        {
-            std::cout << "Number spoken in turn #" << turn << ": " << spokenNumber << "\n";
-            return 0;
-        }
+        static_cast<void>(game.SpeakNumber());
     }
-
-    return 0;
+    return std::int64_t{game.GetLastSpokenNumber()};
 }
 
 } // namespace
 
-int main(const int argc, const char *const argv[])
+class PuzzleDay15Impl final
 {
-    std::cout << "==Day 15==\n";
-#if !defined(NDEBUG)
-    std::cout << "Debug build\n";
-#endif
-    try
-    {
-        std::vector<std::string> input;
-        if (argc >= 2)
-        {
+public:
+    explicit PuzzleDay15Impl(const std::string_view input) : startingNumbers(input) {}
 
-            auto inputVariant = OpenFile(argv[1u]);
-            if (std::holds_alternative<std::ifstream>(inputVariant))
-            {
-                auto &file = std::get<std::ifstream>(inputVariant);
-                std::string line;
-                while (std::getline(file, line))
-                {
-                    input.push_back(line);
-                }
-            }
-        }
-        if (input.size() == 0)
-        {
-            for (const auto &line : aExampleInput)
-            {
-                input.emplace_back(line);
-            }
-        }
+public:
+    const std::string startingNumbers;
+};
 
-        int ret{0};
-        for (const auto &inputLine : input)
-        {
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(15)
 
-            ret = Day15_Part1(inputLine);
-            if (ret == 0)
-            {
-                ret = Day15_Part2(inputLine);
-            }
-            if (ret != 0)
-            {
-                return ret;
-            }
-        }
-        return ret;
-    }
-    catch (...)
-    {
-        std::cerr << "Failed to read or parse input\n";
-        return 1;
-    }
+PuzzleDay15::PuzzleDay15(const std::string_view input) : pImpl(std::make_unique<PuzzleDay15Impl>(input)) {}
+
+PuzzleDay15::~PuzzleDay15() = default;
+
+IPuzzle::Solution_t PuzzleDay15::Part1()
+{
+    constexpr unsigned int turnOfInterest{2020};
+    return PlayMemoryGame(pImpl->startingNumbers, turnOfInterest);
 }
+
+IPuzzle::Solution_t PuzzleDay15::Part2()
+{
+    constexpr unsigned int turnOfInterest{30'000'000};
+    return PlayMemoryGame(pImpl->startingNumbers, turnOfInterest);
+}
+
+} // namespace AOC::Y2020
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "ipuzzle.hpp"
+
+#include <memory>
+#include <string_view>
+
+#define AOC_Y2020_PUZZLE_CLASS_DECLARATION(day)                                                                                  \
+    class PuzzleDay##day##Impl;                                                                                                  \
+    class PuzzleDay##day final : public IPuzzle                                                                                  \
+    {                                                                                                                            \
+    public:                                                                                                                      \
+        explicit PuzzleDay##day(std::string_view input);                                                                         \
+        [[nodiscard]] Solution_t Part1() override;                                                                               \
+        [[nodiscard]] Solution_t Part2() override;                                                                               \
+        ~PuzzleDay##day() override;                                                                                              \
+                                                                                                                                 \
+    private:                                                                                                                     \
+        std::unique_ptr<PuzzleDay##day##Impl> pImpl;                                                                             \
+    };
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string_view>
+
+namespace AOC
+{
+
+/// Invokes fnLineCb for each line of the input, with line endings ("\n" or "\r\n") stripped.
+/// Stops and returns false as soon as the callback returns false.
+template <typename Fn>
+inline bool ParseLines(std::string_view input, Fn &&fnLineCb)
+{
+    while (!input.empty())
+    {
+        const auto endOfLine = input.find('\n');
+        auto line = input.substr(0, endOfLine);
+        if (!line.empty() && (line.back() == '\r'))
+        {
+            line.remove_suffix(1u);
+        }
+        if (!fnLineCb(line))
+        {
+            return false;
+        }
+        if (endOfLine == std::string_view::npos)
+        {
+            break;
+        }
+        input.remove_prefix(endOfLine + 1u);
+    }
+    return true;
+}
+
+} // namespace AOC
@@ -0,0 +1,45 @@
+#include "puzzle_factory.hpp"
+#include "puzzle_common.hpp"
+
+#define AOC_Y2020_SUPPORTED_PUZZLES_LIST(_X_)                                                                                    \
+    _X_(01, 1)                                                                                                                   \
+    _X_(02, 2)                                                                                                                   \
+    _X_(03, 3)                                                                                                                   \
+    _X_(04, 4)                                                                                                                   \
+    _X_(05, 5)                                                                                                                   \
+    _X_(06, 6)                                                                                                                   \
+    _X_(07, 7)                                                                                                                   \
+    _X_(08, 8)                                                                                                                   \
+    _X_(09, 9)                                                                                                                   \
+    _X_(10, 10)                                                                                                                  \
+    _X_(11, 11)                                                                                                                  \
+    _X_(12, 12)                                                                                                                  \
+    _X_(13, 13)                                                                                                                  \
+    _X_(14, 14)                                                                                                                  \
+    _X_(15, 15)
+
+namespace AOC::Y2020
+{
+
+#define AOC_Y2020_PUZZLE_DECLARATION(day, number) AOC_Y2020_PUZZLE_CLASS_DECLARATION(day)
+AOC_Y2020_SUPPORTED_PUZZLES_LIST(AOC_Y2020_PUZZLE_DECLARATION)
+#undef AOC_Y2020_PUZZLE_DECLARATION
+
+std::unique_ptr<IPuzzle> PuzzleFactory::CreatePuzzle(const std::uint8_t day, const std::string_view input)
+{
+    switch (day)
+    {
+#define AOC_Y2020_PUZZLE_CASE(day, number)                                                                                       \
+    case number:                                                                                                                 \
+        return std::make_unique<PuzzleDay##day>(input);
+
+        AOC_Y2020_SUPPORTED_PUZZLES_LIST(AOC_Y2020_PUZZLE_CASE)
+
+#undef AOC_Y2020_PUZZLE_CASE
+
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace AOC::Y2020
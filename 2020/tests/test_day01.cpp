@@ -0,0 +1,37 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(01)
+
+namespace
+{
+
+class Day01Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay01>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput = "1721\n979\r\n366\n299\n675\n1456\n";
+};
+
+TEST_F(Day01Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 514579);
+}
+
+TEST_F(Day01Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 241861950);
+}
+
+} // namespace
+} // namespace AOC::Y2020
@@ -0,0 +1,37 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(02)
+
+namespace
+{
+
+class Day02Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay02>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput = "1-3 a: abcde\n1-3 b: cdefg\r\n2-9 c: ccccccccc";
+};
+
+TEST_F(Day02Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 2);
+}
+
+TEST_F(Day02Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 1);
+}
+
+} // namespace
+} // namespace AOC::Y2020
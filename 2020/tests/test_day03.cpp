@@ -0,0 +1,39 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(03)
+
+namespace
+{
+
+class Day03Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay03>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput =
+        "..##.......\n#...#...#..\n.#....#..#.\n..#.#...#.#\n.#...##..#.\n..#.##.....\n.#.#.#....#\n.#......."
+        ".#\n#.##...#...\n#...##....#\n.#..#...#.#\n";
+};
+
+TEST_F(Day03Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 7);
+}
+
+TEST_F(Day03Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 336);
+}
+
+} // namespace
+} // namespace AOC::Y2020
@@ -0,0 +1,40 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(04)
+
+namespace
+{
+
+class Day04Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay04>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput =
+        "ecl:gry pid:860033327 eyr:2020 hcl:#fffffd\nbyr:1937 iyr:2017 cid:147 hgt:183cm\n\niyr:2013 ecl:amb "
+        "cid:350 eyr:2023 pid:028048884\nhcl:#cfa07d byr:1929\n\nhcl:#ae17e1 iyr:2013\r\neyr:2024\necl:brn pi"
+        "d:760753108 byr:1931\nhgt:179cm\n\nhcl:#cfa07d eyr:2025 pid:166559648\niyr:2011 ecl:brn hgt:59in\n";
+};
+
+TEST_F(Day04Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 2);
+}
+
+TEST_F(Day04Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 2);
+}
+
+} // namespace
+} // namespace AOC::Y2020
@@ -0,0 +1,37 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(05)
+
+namespace
+{
+
+class Day05Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay05>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput = "FBFBBFFRLR\nFFFFFFBLLL\nFFFFFFBLLR\r\nFFFFFFBLRL\nFFFFFFBRLL\nFFFFFFBRLR\n";
+};
+
+TEST_F(Day05Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 357);
+}
+
+TEST_F(Day05Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 11);
+}
+
+} // namespace
+} // namespace AOC::Y2020
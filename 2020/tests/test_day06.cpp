@@ -0,0 +1,37 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(06)
+
+namespace
+{
+
+class Day06Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay06>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput = "abc\n\na\nb\nc\n\nab\r\nac\n\na\na\na\na\n\nb\n";
+};
+
+TEST_F(Day06Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 11);
+}
+
+TEST_F(Day06Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 6);
+}
+
+} // namespace
+} // namespace AOC::Y2020
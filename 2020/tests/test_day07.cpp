@@ -0,0 +1,43 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(07)
+
+namespace
+{
+
+class Day07Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay07>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput =
+        "light red bags contain 1 bright white bag, 2 muted yellow bags.\ndark orange bags contain 3 bright w"
+        "hite bags, 4 muted yellow bags.\nbright white bags contain 1 shiny gold bag.\nmuted yellow bags cont"
+        "ain 2 shiny gold bags, 9 faded blue bags.\nshiny gold bags contain 1 dark olive bag, 2 vibrant plum "
+        "bags.\ndark olive bags contain 3 faded blue bags, 4 dotted black bags.\nvibrant plum bags contain 5 "
+        "faded blue bags, 6 dotted black bags.\nfaded blue bags contain no other bags.\ndotted black bags con"
+        "tain no other bags.\n";
+};
+
+TEST_F(Day07Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 4);
+}
+
+TEST_F(Day07Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 32);
+}
+
+} // namespace
+} // namespace AOC::Y2020
@@ -0,0 +1,37 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(08)
+
+namespace
+{
+
+class Day08Test : public ::testing::Test
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay08>(exampleInput); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+    static constexpr std::string_view exampleInput = "nop +0\nacc +1\njmp +4\nacc +3\njmp -3\r\nacc -9\nacc +1\njmp -4\nacc +6\n";
+};
+
+TEST_F(Day08Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 5);
+}
+
+TEST_F(Day08Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 8);
+}
+
+} // namespace
+} // namespace AOC::Y2020
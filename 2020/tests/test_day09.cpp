@@ -0,0 +1,53 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(09)
+
+namespace
+{
+
+struct Day09TestParams final
+{
+    std::string_view input;
+    std::int64_t expectedResultPart1;
+    std::int64_t expectedResultPart2;
+};
+
+class Day09Test : public testing::TestWithParam<Day09TestParams>
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay09>(GetParam().input); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+};
+
+TEST_P(Day09Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), GetParam().expectedResultPart1);
+}
+
+TEST_P(Day09Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), GetParam().expectedResultPart2);
+}
+
+constexpr Day09TestParams day09ExamplesInOut[] = {
+    {
+        "1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n11\n12\n13\n14\n15\n16\n17\n18\n19\n20\n21\n22\n23\n24\n25\n26\n49\n100\n50\n",
+        100,
+        25,
+    },
+};
+INSTANTIATE_TEST_SUITE_P(Day09Examples, Day09Test, testing::ValuesIn(day09ExamplesInOut));
+
+} // namespace
+} // namespace AOC::Y2020
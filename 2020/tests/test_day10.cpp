@@ -0,0 +1,58 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(10)
+
+namespace
+{
+
+struct Day10TestParams final
+{
+    std::string_view input;
+    std::int64_t expectedResultPart1;
+    std::int64_t expectedResultPart2;
+};
+
+class Day10Test : public testing::TestWithParam<Day10TestParams>
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay10>(GetParam().input); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+};
+
+TEST_P(Day10Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), GetParam().expectedResultPart1);
+}
+
+TEST_P(Day10Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), GetParam().expectedResultPart2);
+}
+
+constexpr Day10TestParams day10ExamplesInOut[] = {
+    {
+        "16\n10\n15\n5\n1\n11\n7\n19\n6\n12\n4\n",
+        35,
+        8,
+    },
+    {
+        "28\n33\n18\n42\n31\n14\n46\n20\n48\n47\n24\n23\n49\n45\n19\n38\n39\n11\n1\n32\n25\n35\n8\n17\n7\n9\n4\n2\n34\n10\n3\n",
+        220,
+        19208,
+    },
+};
+INSTANTIATE_TEST_SUITE_P(Day10Examples, Day10Test, testing::ValuesIn(day10ExamplesInOut));
+
+} // namespace
+} // namespace AOC::Y2020
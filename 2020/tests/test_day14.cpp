@@ -0,0 +1,61 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(14)
+
+namespace
+{
+
+struct Day14TestParams final
+{
+    std::string_view input;
+    std::int64_t expectedResultPart1;
+    std::int64_t expectedResultPart2;
+};
+
+class Day14Test : public testing::TestWithParam<Day14TestParams>
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay14>(GetParam().input); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+};
+
+TEST_P(Day14Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), GetParam().expectedResultPart1);
+}
+
+TEST_P(Day14Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), GetParam().expectedResultPart2);
+}
+
+constexpr Day14TestParams day14ExamplesInOut[] = {
+    {
+        "mask = 000000000000000000000000000000X1001X\nmem[42] = 100\r\nmask = 00000000000000000000000000000000X0XX\nmem[26] = 1\n",
+        51,
+        208,
+    },
+};
+INSTANTIATE_TEST_SUITE_P(Day14Examples, Day14Test, testing::ValuesIn(day14ExamplesInOut));
+
+TEST(Day14Part1Example, Part1)
+{
+    // part 2 would have to write 2^34 addresses for this mask, so only part 1 is checked
+    constexpr std::string_view exampleInput = "mask = XXXXXXXXXXXXXXXXXXXXXXXXXXXXX1XXXX0X\nmem[8] = 11\nmem[7] = 101\nmem[8] = 0\n";
+    PuzzleDay14 puzzle(exampleInput);
+    ASSERT_EQ(std::get<std::int64_t>(puzzle.Part1()), 165);
+}
+
+} // namespace
+} // namespace AOC::Y2020
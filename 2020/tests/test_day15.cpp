@@ -0,0 +1,71 @@
+#include "ipuzzle.hpp"
+#include "puzzle_common.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace AOC::Y2020
+{
+
+AOC_Y2020_PUZZLE_CLASS_DECLARATION(15)
+
+namespace
+{
+
+struct Day15TestParams final
+{
+    std::string_view input;
+    std::int64_t expectedResultPart1;
+    std::int64_t expectedResultPart2;
+};
+
+class Day15Test : public testing::TestWithParam<Day15TestParams>
+{
+protected:
+    void SetUp() override { pPuzzle = std::make_unique<PuzzleDay15>(GetParam().input); }
+
+    std::unique_ptr<IPuzzle> pPuzzle;
+};
+
+TEST_P(Day15Test, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), GetParam().expectedResultPart1);
+}
+
+TEST_P(Day15Test, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), GetParam().expectedResultPart2);
+}
+
+constexpr Day15TestParams day15ExamplesInOut[] = {
+    {
+        "0,3,6",
+        436,
+        175594,
+    },
+    {
+        "3,1,2\n",
+        1836,
+        362,
+    },
+};
+INSTANTIATE_TEST_SUITE_P(Day15Examples, Day15Test, testing::ValuesIn(day15ExamplesInOut));
+
+TEST(Day15StartingNumbersTest, MoreStartingNumbersThanTurns)
+{
+    // the numbers 3000, 2999, ..., 1 are spoken in the first 3000 turns, so turn 2020 speaks 981
+    std::string input;
+    for (unsigned int number = 3000u; number != 0u; --number)
+    {
+        input += std::to_string(number) + ((number != 1u) ? "," : "\n");
+    }
+    PuzzleDay15 puzzle{input};
+    ASSERT_EQ(std::get<std::int64_t>(puzzle.Part1()), 981);
+}
+
+} // namespace
+} // namespace AOC::Y2020
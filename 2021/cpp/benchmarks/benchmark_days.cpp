@@ -0,0 +1,82 @@
+#include "aoc_y2021.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace
+{
+
+/// Measures the complete solve (parse, part 1, part 2) of each engine of each day on the puzzle input.
+void BenchmarkSolve(benchmark::State &state, const std::uint8_t day, const AOC::Y2021::PuzzleEngine engine,
+                    const std::string &input)
+{
+    for (auto _ : state)
+    {
+        auto pPuzzle = AOC::Y2021::PuzzleFactory::CreatePuzzle(day, input, engine);
+        auto part1 = pPuzzle->Part1();
+        auto part2 = pPuzzle->Part2();
+        benchmark::DoNotOptimize(part1);
+        benchmark::DoNotOptimize(part2);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(input.size()));
+}
+
+/// Same as BenchmarkSolve, but through the statically dispatched Solve() without a heap allocated puzzle object.
+void BenchmarkStaticSolve(benchmark::State &state, const std::uint8_t day, const std::string &input)
+{
+    for (auto _ : state)
+    {
+        auto solution = AOC::Y2021::Solve(day, input);
+        benchmark::DoNotOptimize(solution);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(input.size()));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    std::string inputDir = AOC_Y2021_INPUT_DIR;
+    for (int i = 1; i < argc; ++i)
+    {
+        constexpr std::string_view inputDirOption = "--input_dir=";
+        const std::string_view arg{argv[i]};
+        if (arg.starts_with(inputDirOption))
+        {
+            inputDir = arg.substr(inputDirOption.size());
+        }
+    }
+
+    for (std::uint8_t day = 1u; day <= 24u; ++day)
+    {
+        char fileName[16];
+        std::snprintf(fileName, sizeof(fileName), "/day%02u.txt", unsigned(day));
+        std::ifstream ifs(inputDir + fileName);
+        if (!ifs.is_open())
+        {
+            continue;
+        }
+        const std::string input((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        for (const auto engine : AOC::Y2021::PuzzleFactory::GetEngines(day))
+        {
+            const auto name = std::string(fileName + 1, 5) + '/' +
+                              std::string(AOC::Y2021::PuzzleFactory::GetEngineName(engine));
+            benchmark::RegisterBenchmark(name.c_str(), BenchmarkSolve, day, engine, input)
+                ->Unit(benchmark::kMicrosecond);
+        }
+        benchmark::RegisterBenchmark((std::string(fileName + 1, 5) + "/static").c_str(), BenchmarkStaticSolve, day,
+                                     input)
+            ->Unit(benchmark::kMicrosecond);
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,203 @@
+#include "utils.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AOC::Y2021
+{
+
+namespace
+{
+
+constexpr std::size_t inputSize = 64u * 1024u;
+
+void SetBytesProcessed(benchmark::State &state, const std::size_t bytesPerIteration)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(bytesPerIteration));
+}
+
+std::string MakeDigits(std::mt19937 &rng, const std::size_t numDigits, const std::uint8_t base = 10u)
+{
+    constexpr std::string_view digitChars = "0123456789abcdef";
+    std::uniform_int_distribution<std::size_t> digit(0u, base - 1u);
+    std::string number;
+    for (std::size_t i = 0; i != numDigits; ++i)
+    {
+        number.push_back(digitChars[digit(rng)]);
+    }
+    return number;
+}
+
+std::string MakeLines(const std::size_t lineLength, const std::size_t numLines, const bool crlf)
+{
+    std::mt19937 rng;
+    std::string lines;
+    for (std::size_t i = 0; i != numLines; ++i)
+    {
+        lines += MakeDigits(rng, lineLength);
+        lines += crlf ? "\r\n" : "\n";
+    }
+    return lines;
+}
+
+void BM_ParseLines(benchmark::State &state)
+{
+    const auto lineLength = static_cast<std::size_t>(state.range(0));
+    const bool crlf = (state.range(1) != 0);
+    const auto input = MakeLines(lineLength, inputSize / (lineLength + 1u), crlf);
+    for (auto _ : state)
+    {
+        std::size_t numLines = 0;
+        const bool bSuccess = ParseLines(input, [&numLines](const std::string_view line) {
+            benchmark::DoNotOptimize(line.data());
+            ++numLines;
+            return true;
+        });
+        benchmark::DoNotOptimize(bSuccess);
+        benchmark::DoNotOptimize(numLines);
+    }
+    SetBytesProcessed(state, input.size());
+}
+BENCHMARK(BM_ParseLines)->ArgNames({"line_length", "crlf"})->ArgsProduct({{1, 12, 80, 1000}, {0, 1}});
+
+void BM_ParseNumber(benchmark::State &state)
+{
+    const auto numDigits = static_cast<std::size_t>(state.range(0));
+    const auto base = static_cast<std::uint8_t>(state.range(1));
+    std::mt19937 rng;
+    std::vector<std::string> numbers;
+    std::size_t numBytes = 0;
+    for (std::size_t i = 0; i != 1024u; ++i)
+    {
+        numbers.push_back(MakeDigits(rng, numDigits, base));
+        numBytes += numDigits;
+    }
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const auto &number : numbers)
+        {
+            sum += ParseNumber<std::uint64_t>(number, base);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetBytesProcessed(state, numBytes);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(numbers.size()));
+}
+BENCHMARK(BM_ParseNumber)->ArgNames({"digits", "base"})->ArgsProduct({{1, 4, 9, 16}, {2, 10, 16}});
+
+template <char DELIMITER> void BM_ParseToVectorOfNums(benchmark::State &state)
+{
+    const auto numDigits = static_cast<std::size_t>(state.range(0));
+    std::mt19937 rng;
+    std::string input;
+    while (input.size() < inputSize)
+    {
+        input += MakeDigits(rng, numDigits);
+        input += DELIMITER;
+    }
+    for (auto _ : state)
+    {
+        auto numbers = ParseToVectorOfNums<int, DELIMITER>(input);
+        benchmark::DoNotOptimize(numbers.data());
+    }
+    SetBytesProcessed(state, input.size());
+}
+BENCHMARK_TEMPLATE(BM_ParseToVectorOfNums, ',')->ArgName("digits")->Arg(1)->Arg(3)->Arg(9);
+BENCHMARK_TEMPLATE(BM_ParseToVectorOfNums, '\n')->ArgName("digits")->Arg(1)->Arg(3)->Arg(9);
+
+void BM_ParseToVector2D(benchmark::State &state)
+{
+    const auto width = static_cast<std::size_t>(state.range(0));
+    const bool crlf = (state.range(1) != 0);
+    const auto input = MakeLines(width, width, crlf);
+    for (auto _ : state)
+    {
+        auto map = ParseToVector2D(input);
+        benchmark::DoNotOptimize(map.width());
+        benchmark::DoNotOptimize(map[0]);
+    }
+    SetBytesProcessed(state, input.size());
+}
+BENCHMARK(BM_ParseToVector2D)->ArgNames({"width", "crlf"})->ArgsProduct({{10, 100, 1000}, {0, 1}});
+
+Vector2D<std::uint8_t> MakeVector2D(const std::size_t width)
+{
+    return ParseToVector2D(MakeLines(width, width, false));
+}
+
+void BM_Vector2DRowMajor(benchmark::State &state)
+{
+    const auto map = MakeVector2D(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        unsigned sum = 0;
+        for (std::size_t row = 0; row != map.height(); ++row)
+        {
+            for (std::size_t col = 0; col != map.width(); ++col)
+            {
+                sum += map(col, row);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetBytesProcessed(state, map.size());
+}
+BENCHMARK(BM_Vector2DRowMajor)->ArgName("width")->Arg(64)->Arg(512)->Arg(2048);
+
+void BM_Vector2DColumnMajor(benchmark::State &state)
+{
+    const auto map = MakeVector2D(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        unsigned sum = 0;
+        for (std::size_t col = 0; col != map.width(); ++col)
+        {
+            for (std::size_t row = 0; row != map.height(); ++row)
+            {
+                sum += map(col, row);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetBytesProcessed(state, map.size());
+}
+BENCHMARK(BM_Vector2DColumnMajor)->ArgName("width")->Arg(64)->Arg(512)->Arg(2048);
+
+/// 4-neighborhood access as done by the grid puzzles (days 09, 11, 15)
+void BM_Vector2DNeighbors(benchmark::State &state)
+{
+    const auto map = MakeVector2D(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        unsigned numLowPoints = 0;
+        for (std::size_t row = 1; (row + 1u) < map.height(); ++row)
+        {
+            for (std::size_t col = 1; (col + 1u) < map.width(); ++col)
+            {
+                const auto value = map(col, row);
+                numLowPoints += ((value < map(col - 1u, row)) && (value < map(col + 1u, row)) &&
+                                 (value < map(col, row - 1u)) && (value < map(col, row + 1u)))
+                                    ? 1u
+                                    : 0u;
+            }
+        }
+        benchmark::DoNotOptimize(numLowPoints);
+    }
+    SetBytesProcessed(state, map.size());
+}
+BENCHMARK(BM_Vector2DNeighbors)->ArgName("width")->Arg(64)->Arg(512)->Arg(2048);
+
+} // namespace
+
+} // namespace AOC::Y2021
+
+BENCHMARK_MAIN();
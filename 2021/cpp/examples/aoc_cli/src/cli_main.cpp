@@ -4,17 +4,70 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <streambuf>
 #include <string>
+#include <string_view>
 #include <variant>
 
+namespace
+{
+
+void PrintSolution(const AOC::Y2021::IPuzzle::Solution_t &solution)
+{
+    if (std::holds_alternative<std::int64_t>(solution))
+    {
+        std::cout << std::get<std::int64_t>(solution);
+    }
+    else if (std::holds_alternative<std::string>(solution))
+    {
+        std::cout << std::get<std::string>(solution);
+    }
+    else
+    {
+        std::cout << "<no solution>";
+    }
+}
+
+int VerifyEngines(const std::uint8_t day, const std::string_view input)
+{
+    using AOC::Y2021::PuzzleFactory;
+    const auto engines = PuzzleFactory::GetEngines(day);
+    std::cout << "verifying engines:";
+    for (const auto engine : engines)
+    {
+        std::cout << ' ' << PuzzleFactory::GetEngineName(engine);
+    }
+    std::cout << '\n';
+    const auto mismatches = PuzzleFactory::VerifyEngines(day, input);
+    for (const auto &mismatch : mismatches)
+    {
+        std::cout << "mismatch: engine " << PuzzleFactory::GetEngineName(mismatch.engine) << " part "
+                  << unsigned(mismatch.part) << ": expected ";
+        PrintSolution(mismatch.expected);
+        std::cout << ", got ";
+        PrintSolution(mismatch.actual);
+        std::cout << '\n';
+    }
+    if (!mismatches.empty())
+    {
+        std::cerr << "error: engines disagree\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "all engines agree\n";
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+
 int main(const int argc, const char *const argv[])
 {
     std::cout << "==Advent of Code 2021==\n";
     if (argc < 3)
     {
         const char *const executableName = ((argc > 0) && (argv != nullptr) && (argv[0u] != nullptr)) ? argv[0u] : "";
-        std::cout << "usage: " << executableName << " <day> <inputfile>\n";
+        std::cout << "usage: " << executableName
+                  << " <day> <inputfile> [--engine reference|optimized|parallel] [--verify]\n";
         std::cout << "example: " << executableName << " 1 input01.txt\n";
         return (argc == 1) ? EXIT_SUCCESS : EXIT_FAILURE;
     }
@@ -37,6 +90,32 @@ int main(const int argc, const char *const argv[])
         return EXIT_FAILURE;
     }
 
+    auto engine = AOC::Y2021::PuzzleEngine::Reference;
+    bool bVerify = false;
+    for (int i = 3; i < argc; ++i)
+    {
+        const std::string_view arg{argv[i]};
+        if (arg == "--verify")
+        {
+            bVerify = true;
+        }
+        else if ((arg == "--engine") && ((i + 1) < argc))
+        {
+            const auto parsedEngine = AOC::Y2021::PuzzleFactory::ParseEngineName(argv[++i]);
+            if (!parsedEngine.has_value())
+            {
+                std::cerr << "error: unknown engine " << argv[i] << '\n';
+                return EXIT_FAILURE;
+            }
+            engine = *parsedEngine;
+        }
+        else
+        {
+            std::cerr << "error: unknown option " << arg << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+
     std::ifstream ifs(argv[2u]);
     if (!ifs.is_open())
     {
@@ -51,10 +130,21 @@ int main(const int argc, const char *const argv[])
         return EXIT_FAILURE;
     }
 
-    auto pPuzzle = AOC::Y2021::PuzzleFactory::CreatePuzzle(day, input);
+    if (bVerify)
+    {
+        if (AOC::Y2021::PuzzleFactory::GetEngines(day).empty())
+        {
+            std::cerr << "sorry, no implementation for day " << unsigned(day) << '\n';
+            return EXIT_FAILURE;
+        }
+        return VerifyEngines(day, input);
+    }
+
+    auto pPuzzle = AOC::Y2021::PuzzleFactory::CreatePuzzle(day, input, engine);
     if (pPuzzle == nullptr)
     {
-        std::cerr << "sorry, no implementation for day " << unsigned(day) << '\n';
+        std::cerr << "sorry, no " << AOC::Y2021::PuzzleFactory::GetEngineName(engine) << " implementation for day "
+                  << unsigned(day) << '\n';
         return EXIT_FAILURE;
     }
 
@@ -0,0 +1,490 @@
+#include "aoc_y2021.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AOC_Y2021_PERF_FUZZ_ISOLATE_RUNS (1)
+#include <csignal>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#else
+#define AOC_Y2021_PERF_FUZZ_ISOLATE_RUNS (0)
+#endif
+
+namespace
+{
+
+/// Searches for inputs which maximize the time a puzzle spends per input byte.
+/// Instead of looking for crashes like a classic fuzzer, every candidate is scored by the wall time of
+/// Part1() + Part2() divided by its size. The slowest candidates form the corpus from which new candidates are
+/// mutated, and they are written to the output directory once the search is done.
+struct Options
+{
+    std::uint8_t day{0};
+    AOC::Y2021::PuzzleEngine engine{AOC::Y2021::PuzzleEngine::Reference};
+    std::vector<std::string> seedFiles;
+    std::string outDir{"perf_fuzz_out"};
+    std::size_t iterations{2000};
+    std::size_t maxLen{4096};
+    std::size_t corpusSize{8};
+    std::uint32_t timeoutMs{2000};
+    std::uint32_t memLimitMb{1024};
+    std::uint32_t rngSeed{5489u};
+};
+
+enum class RunStatus
+{
+    ok,
+    timeout,
+    crash,
+};
+
+struct Candidate
+{
+    std::string input;
+    double seconds{0.0};
+    RunStatus status{RunStatus::ok};
+
+    [[nodiscard]] double Score() const
+    {
+        return seconds / static_cast<double>(std::max<std::size_t>(input.size(), 1u));
+    }
+};
+
+[[nodiscard]] double SolveAndMeasure(const Options &options, const std::string &input)
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto pPuzzle = AOC::Y2021::PuzzleFactory::CreatePuzzle(options.day, input, options.engine);
+    if (pPuzzle != nullptr)
+    {
+        const auto part1 = pPuzzle->Part1();
+        const auto part2 = pPuzzle->Part2();
+        static_cast<void>(part1.index() + part2.index());
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// Runs a single candidate. On POSIX systems, each run is isolated in a child process with a time and memory
+/// limit, so that inputs which make a puzzle hang or allocate gigabytes are reported instead of taking the
+/// fuzzer down.
+[[nodiscard]] Candidate Evaluate(const Options &options, std::string input)
+{
+    Candidate candidate{std::move(input)};
+#if AOC_Y2021_PERF_FUZZ_ISOLATE_RUNS
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        candidate.status = RunStatus::crash;
+        return candidate;
+    }
+    const auto pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        const rlim_t memLimit = static_cast<rlim_t>(options.memLimitMb) * 1024u * 1024u;
+        const rlimit limit{memLimit, memLimit};
+        setrlimit(RLIMIT_AS, &limit);
+        itimerval timer{};
+        timer.it_value.tv_sec = static_cast<time_t>(options.timeoutMs / 1000u);
+        timer.it_value.tv_usec = static_cast<suseconds_t>((options.timeoutMs % 1000u) * 1000u);
+        setitimer(ITIMER_REAL, &timer, nullptr);
+        double seconds = 0.0;
+        try
+        {
+            seconds = SolveAndMeasure(options, candidate.input);
+        }
+        catch (...)
+        {
+            _exit(EXIT_FAILURE);
+        }
+        const auto written = write(fds[1], &seconds, sizeof(seconds));
+        _exit((written == static_cast<ssize_t>(sizeof(seconds))) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    close(fds[1]);
+    if (pid < 0)
+    {
+        close(fds[0]);
+        candidate.status = RunStatus::crash;
+        return candidate;
+    }
+    double seconds = 0.0;
+    const auto bytesRead = read(fds[0], &seconds, sizeof(seconds));
+    close(fds[0]);
+    int wstatus = 0;
+    waitpid(pid, &wstatus, 0);
+    if (WIFSIGNALED(wstatus) && (WTERMSIG(wstatus) == SIGALRM))
+    {
+        candidate.status = RunStatus::timeout;
+        candidate.seconds = static_cast<double>(options.timeoutMs) / 1000.0;
+    }
+    else if (!WIFEXITED(wstatus) || (WEXITSTATUS(wstatus) != EXIT_SUCCESS) ||
+             (bytesRead != static_cast<ssize_t>(sizeof(seconds))))
+    {
+        candidate.status = RunStatus::crash;
+    }
+    else
+    {
+        candidate.seconds = seconds;
+    }
+#else
+    try
+    {
+        candidate.seconds = SolveAndMeasure(options, candidate.input);
+    }
+    catch (...)
+    {
+        candidate.status = RunStatus::crash;
+    }
+#endif
+    return candidate;
+}
+
+class Mutator final
+{
+  public:
+    explicit Mutator(const std::uint32_t seed) : rng(seed)
+    {
+    }
+
+    [[nodiscard]] std::string Mutate(const std::string &parent, const std::vector<Candidate> &corpus,
+                                     const std::size_t maxLen)
+    {
+        std::string child = parent;
+        const auto numMutations = Random(1u, 4u);
+        for (std::size_t i = 0; i != numMutations; ++i)
+        {
+            switch (Random(0u, 6u))
+            {
+            case 0:
+                ReplaceByte(child);
+                break;
+            case 1:
+                InsertByte(child);
+                break;
+            case 2:
+                EraseRange(child);
+                break;
+            case 3:
+                DuplicateLine(child);
+                break;
+            case 4:
+                GrowNumber(child);
+                break;
+            case 5:
+                Splice(child, corpus[Random(0u, corpus.size() - 1u)].input);
+                break;
+            default:
+                DuplicateRange(child);
+                break;
+            }
+        }
+        if (child.size() > maxLen)
+        {
+            child.resize(maxLen);
+        }
+        return child;
+    }
+
+    [[nodiscard]] std::size_t Random(const std::size_t min, const std::size_t max)
+    {
+        return std::uniform_int_distribution<std::size_t>(min, max)(rng);
+    }
+
+  private:
+    /// Picks a byte which already occurs in the input, so that mutations stay close to the input grammar.
+    [[nodiscard]] char ByteFromAlphabet(const std::string &str)
+    {
+        if (str.empty())
+        {
+            return static_cast<char>('0' + Random(0u, 9u));
+        }
+        return str[Random(0u, str.size() - 1u)];
+    }
+
+    void ReplaceByte(std::string &str)
+    {
+        if (!str.empty())
+        {
+            str[Random(0u, str.size() - 1u)] = ByteFromAlphabet(str);
+        }
+    }
+
+    void InsertByte(std::string &str)
+    {
+        str.insert(str.begin() + static_cast<std::ptrdiff_t>(Random(0u, str.size())), ByteFromAlphabet(str));
+    }
+
+    void EraseRange(std::string &str)
+    {
+        if (str.size() > 1u)
+        {
+            const auto pos = Random(0u, str.size() - 1u);
+            str.erase(pos, Random(1u, std::min<std::size_t>(8u, str.size() - pos)));
+        }
+    }
+
+    void DuplicateRange(std::string &str)
+    {
+        if (!str.empty())
+        {
+            const auto pos = Random(0u, str.size() - 1u);
+            const auto len = Random(1u, std::min<std::size_t>(32u, str.size() - pos));
+            str.insert(Random(0u, str.size()), str.substr(pos, len));
+        }
+    }
+
+    /// Copies a random line to a random line boundary. Most puzzle inputs are lists of lines, so this grows the
+    /// problem size while keeping the input valid.
+    void DuplicateLine(std::string &str)
+    {
+        std::vector<std::size_t> lineStarts{0u};
+        for (std::size_t i = 0; i != str.size(); ++i)
+        {
+            if ((str[i] == '\n') && ((i + 1u) < str.size()))
+            {
+                lineStarts.push_back(i + 1u);
+            }
+        }
+        const auto lineIdx = Random(0u, lineStarts.size() - 1u);
+        const auto lineStart = lineStarts[lineIdx];
+        const auto lineEnd = (lineIdx + 1u < lineStarts.size()) ? lineStarts[lineIdx + 1u] : str.size();
+        auto line = str.substr(lineStart, lineEnd - lineStart);
+        if (line.empty() || (line.back() != '\n'))
+        {
+            line.push_back('\n');
+        }
+        str.insert(lineStarts[Random(0u, lineStarts.size() - 1u)], line);
+    }
+
+    /// Replaces a digit by '9' or appends one, which targets solvers whose cost scales with value ranges.
+    void GrowNumber(std::string &str)
+    {
+        std::vector<std::size_t> digits;
+        for (std::size_t i = 0; i != str.size(); ++i)
+        {
+            if ((str[i] >= '0') && (str[i] <= '9'))
+            {
+                digits.push_back(i);
+            }
+        }
+        if (digits.empty())
+        {
+            return;
+        }
+        const auto pos = digits[Random(0u, digits.size() - 1u)];
+        if (Random(0u, 1u) == 0u)
+        {
+            str[pos] = '9';
+        }
+        else
+        {
+            str.insert(pos, 1u, '9');
+        }
+    }
+
+    void Splice(std::string &str, const std::string &other)
+    {
+        if (other.empty())
+        {
+            return;
+        }
+        const auto cut = Random(0u, str.size());
+        const auto otherCut = Random(0u, other.size() - 1u);
+        str = str.substr(0, cut) + other.substr(otherCut);
+    }
+
+  private:
+    std::mt19937 rng;
+};
+
+void InsertIntoCorpus(std::vector<Candidate> &corpus, Candidate &&candidate, const std::size_t corpusSize)
+{
+    const auto isSlower = [](const Candidate &lhs, const Candidate &rhs) { return lhs.Score() > rhs.Score(); };
+    if ((corpus.size() >= corpusSize) && !isSlower(candidate, corpus.back()))
+    {
+        return;
+    }
+    if (std::any_of(corpus.begin(), corpus.end(), [&candidate](const auto &c) { return c.input == candidate.input; }))
+    {
+        return;
+    }
+    corpus.insert(std::upper_bound(corpus.begin(), corpus.end(), candidate, isSlower), std::move(candidate));
+    if (corpus.size() > corpusSize)
+    {
+        corpus.pop_back();
+    }
+}
+
+[[nodiscard]] const char *StatusName(const RunStatus status)
+{
+    switch (status)
+    {
+    case RunStatus::timeout:
+        return "timeout";
+    case RunStatus::crash:
+        return "crash";
+    default:
+        return "ok";
+    }
+}
+
+[[nodiscard]] bool ParseOptions(const int argc, const char *const argv[], Options &options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg{argv[i]};
+        const bool hasValue = (i + 1) < argc;
+        const auto nextNumber = [&]() { return std::strtoul(argv[++i], nullptr, 10); };
+        if ((arg == "--iterations") && hasValue)
+        {
+            options.iterations = nextNumber();
+        }
+        else if ((arg == "--max-len") && hasValue)
+        {
+            options.maxLen = nextNumber();
+        }
+        else if ((arg == "--corpus") && hasValue)
+        {
+            options.corpusSize = std::max<std::size_t>(nextNumber(), 1u);
+        }
+        else if ((arg == "--timeout-ms") && hasValue)
+        {
+            options.timeoutMs = static_cast<std::uint32_t>(std::max<unsigned long>(nextNumber(), 1u));
+        }
+        else if ((arg == "--mem-limit-mb") && hasValue)
+        {
+            options.memLimitMb = static_cast<std::uint32_t>(nextNumber());
+        }
+        else if ((arg == "--seed") && hasValue)
+        {
+            options.rngSeed = static_cast<std::uint32_t>(nextNumber());
+        }
+        else if ((arg == "--engine") && hasValue)
+        {
+            const auto engine = AOC::Y2021::PuzzleFactory::ParseEngineName(argv[++i]);
+            if (!engine.has_value())
+            {
+                std::cerr << "error: unknown engine " << argv[i] << '\n';
+                return false;
+            }
+            options.engine = *engine;
+        }
+        else if ((arg == "--out") && hasValue)
+        {
+            options.outDir = argv[++i];
+        }
+        else if (options.day == 0)
+        {
+            const auto day = std::strtol(argv[i], nullptr, 10);
+            if ((day < 1) || (day > 24))
+            {
+                std::cerr << "error: please select a day from 1 and 24\n";
+                return false;
+            }
+            options.day = static_cast<std::uint8_t>(day);
+        }
+        else
+        {
+            options.seedFiles.emplace_back(arg);
+        }
+    }
+    return (options.day != 0) && !options.seedFiles.empty();
+}
+
+} // namespace
+
+int main(const int argc, const char *const argv[])
+{
+    std::cout << "==Advent of Code 2021 performance fuzzer==\n";
+    Options options;
+    if ((argv == nullptr) || !ParseOptions(argc, argv, options))
+    {
+        const char *const executableName = ((argc > 0) && (argv != nullptr) && (argv[0u] != nullptr)) ? argv[0u] : "";
+        std::cout << "usage: " << executableName
+                  << " <day> <seedfile>... [--iterations N] [--max-len BYTES] [--corpus N] [--timeout-ms MS]"
+                     " [--mem-limit-mb MB] [--seed N] [--engine NAME] [--out DIR]\n";
+        std::cout << "example: " << executableName << " 12 input12.txt --iterations 5000\n";
+        return (argc == 1) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    std::vector<Candidate> corpus;
+    for (const auto &seedFile : options.seedFiles)
+    {
+        std::ifstream ifs(seedFile, std::ios::binary);
+        if (!ifs.is_open())
+        {
+            std::cerr << "error: cannot open seed file " << seedFile << '\n';
+            return EXIT_FAILURE;
+        }
+        std::string seed((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        if (seed.size() > options.maxLen)
+        {
+            seed.resize(options.maxLen);
+        }
+        InsertIntoCorpus(corpus, Evaluate(options, std::move(seed)), options.corpusSize);
+    }
+    if (corpus.empty())
+    {
+        std::cerr << "error: no usable seed\n";
+        return EXIT_FAILURE;
+    }
+    if (AOC::Y2021::PuzzleFactory::CreatePuzzle(options.day, corpus.front().input, options.engine) == nullptr)
+    {
+        std::cerr << "sorry, no " << AOC::Y2021::PuzzleFactory::GetEngineName(options.engine)
+                  << " implementation for day " << unsigned(options.day) << '\n';
+        return EXIT_FAILURE;
+    }
+
+    Mutator mutator(options.rngSeed);
+    for (std::size_t iteration = 0; iteration != options.iterations; ++iteration)
+    {
+        // favor the slowest inputs found so far as parents
+        const auto parentIdx = std::min(mutator.Random(0u, corpus.size() - 1u), mutator.Random(0u, corpus.size() - 1u));
+        auto candidate = Evaluate(options, mutator.Mutate(corpus[parentIdx].input, corpus, options.maxLen));
+        if (candidate.status == RunStatus::crash)
+        {
+            continue;
+        }
+        InsertIntoCorpus(corpus, std::move(candidate), options.corpusSize);
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(options.outDir, ec);
+    if (ec)
+    {
+        std::cerr << "error: cannot create output directory " << options.outDir << '\n';
+        return EXIT_FAILURE;
+    }
+    std::cout << "rank  status   bytes   seconds       ns/byte   file\n";
+    for (std::size_t rank = 0; rank != corpus.size(); ++rank)
+    {
+        const auto &candidate = corpus[rank];
+        std::ostringstream fileName;
+        fileName << "day" << std::setw(2) << std::setfill('0') << unsigned(options.day) << "_slow_" << rank << ".txt";
+        const auto path = std::filesystem::path(options.outDir) / fileName.str();
+        std::ofstream(path, std::ios::binary) << candidate.input;
+        std::cout << std::setw(4) << rank << "  " << std::setw(7) << std::left << StatusName(candidate.status)
+                  << std::right << std::setw(7) << candidate.input.size() << "  " << std::setw(10) << std::fixed
+                  << std::setprecision(6) << candidate.seconds << "  " << std::setw(12) << std::setprecision(1)
+                  << (candidate.Score() * 1e9) << "   " << path.string() << '\n';
+    }
+    return EXIT_SUCCESS;
+}
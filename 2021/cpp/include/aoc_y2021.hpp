@@ -2,6 +2,11 @@
 #define AOC_Y2021_HPP (1)
 
 #include "types.hpp"
+#include "crab_alignment.hpp"
+#include "lanternfish_forecast.hpp"
 #include "puzzle_factory.hpp"
+#include "puzzle_solve.hpp"
+#include "sonar_monitor.hpp"
+#include "sonar_sweep.hpp"
 
 #endif // !defined(AOC_Y2021_HPP)
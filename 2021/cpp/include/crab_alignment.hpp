@@ -0,0 +1,23 @@
+#if !defined(AOC_Y2021_CRAB_ALIGNMENT_HPP)
+#define AOC_Y2021_CRAB_ALIGNMENT_HPP (1)
+
+#include "ipuzzle.hpp"
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace AOC::Y2021
+{
+
+/// Day 07 fuel for all crabs to align at the position, given the number of crabs at each position. Each crab burns its
+/// distance if bConstantFuelBurn, the triangular number of its distance otherwise. The fuel is std::int64_t if it fits,
+/// a decimal string otherwise, and std::monostate if the position lies outside the histogram.
+AOC_Y2021_API
+IPuzzle::Solution_t CalculateAlignmentFuel(std::span<const std::uint64_t> positionHistogram, std::size_t position,
+                                           bool bConstantFuelBurn);
+
+} // namespace AOC::Y2021
+
+#endif // !defined(AOC_Y2021_CRAB_ALIGNMENT_HPP)
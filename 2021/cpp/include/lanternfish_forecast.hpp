@@ -0,0 +1,53 @@
+#if !defined(AOC_Y2021_LANTERNFISH_FORECAST_HPP)
+#define AOC_Y2021_LANTERNFISH_FORECAST_HPP (1)
+
+#include "types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace AOC::Y2021
+{
+
+/// Runtime version of the day 06 lanternfish simulation for arbitrary day counts. The population after n days is the
+/// initial histogram multiplied with the n-th power of the 9x9 timer transition matrix, raised by repeated squaring.
+AOC_Y2021_API
+class LanternfishForecast final
+{
+  public:
+    static constexpr std::size_t numTimerValues = 9u;
+    /// number of fish per timer value
+    using PopulationHistogram = std::array<std::int64_t, numTimerValues>;
+
+  public:
+    explicit LanternfishForecast(const PopulationHistogram &initial);
+
+    /// population after the given days, std::nullopt if it does not fit into std::int64_t
+    [[nodiscard]] std::optional<std::int64_t> GetPopulation(std::uint64_t days) const;
+
+    /// populations after each of the ascending days, sharing the work between the horizons. Returns an empty vector if
+    /// the days are not sorted.
+    [[nodiscard]] std::vector<std::optional<std::int64_t>> GetPopulations(
+        std::span<const std::uint64_t> sortedDays) const;
+
+    /// population after the given days as decimal string, std::nullopt if it does not fit into 128 bit
+    [[nodiscard]] std::optional<std::string> GetPopulation128(std::uint64_t days) const;
+
+    /// population after the given days modulo e.g. a prime like 1'000'000'007, std::nullopt for the modulus 0
+    [[nodiscard]] std::optional<std::uint32_t> GetPopulationModulo(std::uint64_t days, std::uint32_t modulus) const;
+
+    /// exact population after the given days as decimal string. Its length grows linearly with the days.
+    [[nodiscard]] std::string GetExactPopulation(std::uint64_t days) const;
+
+  private:
+    PopulationHistogram initial;
+};
+
+} // namespace AOC::Y2021
+
+#endif // !defined(AOC_Y2021_LANTERNFISH_FORECAST_HPP)
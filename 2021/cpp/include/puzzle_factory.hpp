@@ -6,16 +6,51 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 namespace AOC::Y2021
 {
 
+/// Solver implementation of a puzzle. Every supported day provides the reference engine, which serves as the oracle
+/// for the other engines.
+enum class PuzzleEngine : std::uint8_t
+{
+    Reference,
+    Optimized,
+    Parallel,
+};
+
 AOC_Y2021_API
 class PuzzleFactory final
 {
+  public:
+    struct EngineMismatch
+    {
+        PuzzleEngine engine;
+        std::uint8_t part;
+        IPuzzle::Solution_t expected;
+        IPuzzle::Solution_t actual;
+    };
+
   public:
     static std::unique_ptr<IPuzzle> CreatePuzzle(std::uint8_t game, std::string_view input);
+    static std::unique_ptr<IPuzzle> CreatePuzzle(std::uint8_t game, std::string_view input, PuzzleEngine engine);
+
+    /// Lists the engines available for a day, starting with the reference engine. Empty if the day is not supported.
+    static std::vector<PuzzleEngine> GetEngines(std::uint8_t game);
+
+    /// Solves the input with every engine of a day and reports each result that differs from the reference engine.
+    static std::vector<EngineMismatch> VerifyEngines(std::uint8_t game, std::string_view input);
+
+    /// Solves both parts with the puzzle of an engine and reports each result that differs from the expected one.
+    static std::vector<EngineMismatch> CompareSolutions(PuzzleEngine engine, IPuzzle &puzzle,
+                                                        const IPuzzle::Solution_t &expectedPart1,
+                                                        const IPuzzle::Solution_t &expectedPart2);
+
+    static std::string_view GetEngineName(PuzzleEngine engine);
+    static std::optional<PuzzleEngine> ParseEngineName(std::string_view name);
 };
 
 } // namespace AOC::Y2021
@@ -0,0 +1,47 @@
+#if !defined(AOC_Y2021_PUZZLE_SOLVE_HPP)
+#define AOC_Y2021_PUZZLE_SOLVE_HPP (1)
+
+#include "ipuzzle.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+namespace AOC::Y2021
+{
+
+struct PuzzleSolution
+{
+    IPuzzle::Solution_t part1;
+    IPuzzle::Solution_t part2;
+};
+
+/// Solves both parts of a day with its reference engine. Unlike PuzzleFactory::CreatePuzzle, the puzzle state lives
+/// on the stack and the solver is called directly, without virtual calls or heap allocations for the puzzle object.
+/// Only defined for supported days, so using an unsupported day fails to link.
+template <std::uint8_t DAY> AOC_Y2021_API PuzzleSolution Solve(std::string_view input);
+
+/// The specializations are defined in the translation unit of their day, so calls from other translation units are not
+/// inlined.
+template <> AOC_Y2021_API PuzzleSolution Solve<1>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<2>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<3>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<4>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<5>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<6>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<7>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<8>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<9>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<10>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<11>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<12>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<13>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<14>(std::string_view input);
+template <> AOC_Y2021_API PuzzleSolution Solve<15>(std::string_view input);
+
+/// Runtime day selection for Solve<DAY>(), both parts are std::monostate if the day is not supported.
+AOC_Y2021_API PuzzleSolution Solve(std::uint8_t day, std::string_view input);
+
+} // namespace AOC::Y2021
+
+#endif // !defined(AOC_Y2021_PUZZLE_SOLVE_HPP)
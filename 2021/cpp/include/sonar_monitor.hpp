@@ -0,0 +1,46 @@
+#if !defined(AOC_Y2021_SONAR_MONITOR_HPP)
+#define AOC_Y2021_SONAR_MONITOR_HPP (1)
+
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace AOC::Y2021
+{
+
+/// Online version of the day 01 sonar sweep: counts depth increases of sliding windows while depth samples arrive.
+/// Only the last samples of the largest window are kept in a ring buffer, so memory does not grow with the stream.
+AOC_Y2021_API
+class SonarMonitor final
+{
+  public:
+    explicit SonarMonitor(std::span<const std::size_t> windowSizes);
+
+    void Push(int depth);
+    void Push(std::span<const int> depths);
+
+    /// number of window sum increases so far, std::nullopt if the window size is not monitored
+    [[nodiscard]] std::optional<std::int64_t> GetIncreases(std::size_t windowSize) const;
+    [[nodiscard]] std::uint64_t GetNumSamples() const;
+
+  private:
+    struct Window
+    {
+        std::size_t size;
+        std::int64_t increases;
+    };
+
+  private:
+    std::vector<Window> windows;
+    std::vector<int> history;
+    std::size_t historyHead{0};
+    std::uint64_t numSamples{0};
+};
+
+} // namespace AOC::Y2021
+
+#endif // !defined(AOC_Y2021_SONAR_MONITOR_HPP)
@@ -0,0 +1,20 @@
+#if !defined(AOC_Y2021_SONAR_SWEEP_HPP)
+#define AOC_Y2021_SONAR_SWEEP_HPP (1)
+
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace AOC::Y2021
+{
+
+/// Day 01 sonar sweep for any window size: counts how often the sum of a sliding window of windowSize depths increases
+/// along a complete depth record. 0 if the window is empty or not shorter than the record.
+AOC_Y2021_API
+std::int64_t CountDepthIncreases(std::span<const int> depths, std::size_t windowSize);
+
+} // namespace AOC::Y2021
+
+#endif // !defined(AOC_Y2021_SONAR_SWEEP_HPP)
@@ -1,10 +1,18 @@
 #include "ipuzzle.hpp"
+#include "parallel_utils.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
+#include "sonar_monitor.hpp"
+#include "sonar_sweep.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <numeric>
+#include <optional>
+#include <span>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -14,6 +22,31 @@ namespace AOC::Y2021
 
 constexpr std::size_t windowSize = 3u;
 
+namespace
+{
+
+/// Counts how often the sum of a sliding window increases. Consecutive windows share all but one measurement, so
+/// sum(window[i + 1]) > sum(window[i]) reduces to measurements[i + windowSize] > measurements[i]. Without dependencies
+/// between iterations, the compiler turns the loop into a vectorized compare and count.
+constexpr std::int64_t CountWindowIncreases(const std::span<const int> measurements, const std::size_t windowSize_)
+{
+    if ((windowSize_ == 0u) || (measurements.size() <= windowSize_))
+    {
+        return 0;
+    }
+    const int *const pLeaving = measurements.data();
+    const int *const pEntering = pLeaving + windowSize_;
+    const std::size_t numComparisons = measurements.size() - windowSize_;
+    std::int64_t increases = 0;
+    for (std::size_t i = 0; i != numComparisons; ++i)
+    {
+        increases += static_cast<std::int64_t>(pEntering[i] > pLeaving[i]);
+    }
+    return increases;
+}
+
+} // namespace
+
 class PuzzleDay01Impl final
 {
   public:
@@ -21,36 +54,19 @@ class PuzzleDay01Impl final
     {
     }
 
-    AOC_Y2021_CONSTEXPR std::int64_t Part01()
+    AOC_Y2021_CONSTEXPR std::int64_t Part01() const
     {
-        if (measurements.size() < 2u)
-        {
-            return 0u;
-        }
-        std::vector<int> adjacent_diffs(measurements.size(), -1);
-        std::adjacent_difference(measurements.begin(), measurements.end(), adjacent_diffs.begin());
-        return std::count_if(adjacent_diffs.begin() + 1u, adjacent_diffs.end(), [](const auto &i) { return i > 0; });
+        return CountIncreases(1u);
     }
 
-    AOC_Y2021_CONSTEXPR std::int64_t Part02()
+    AOC_Y2021_CONSTEXPR std::int64_t Part02() const
     {
-        if (measurements.size() <= windowSize)
-        {
-            return 0u;
-        }
-        const auto vecEnd = measurements.end();
-        int prevWindowSum = 0;
-        std::int64_t ret = -1;
-        for (auto end = measurements.begin() + windowSize; end <= vecEnd; end++)
-        {
-            const int windowSum = std::accumulate(end - windowSize, end, 0);
-            if (windowSum > prevWindowSum)
-            {
-                ret++;
-            }
-            prevWindowSum = windowSum;
-        }
-        return ret > 0 ? ret : 0;
+        return CountIncreases(windowSize);
+    }
+
+    AOC_Y2021_CONSTEXPR std::int64_t CountIncreases(const std::size_t slidingWindowSize) const
+    {
+        return CountWindowIncreases(measurements, slidingWindowSize);
     }
 
     auto GetDataSize() const
@@ -64,6 +80,29 @@ class PuzzleDay01Impl final
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(01)
 
+namespace
+{
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay01Impl &impl)
+{
+    if (impl.GetDataSize() < 2)
+    {
+        return std::monostate{};
+    }
+    return impl.Part01();
+}
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay01Impl &impl)
+{
+    if (impl.GetDataSize() <= windowSize)
+    {
+        return std::monostate{};
+    }
+    return impl.Part02();
+}
+
+} // namespace
+
 PuzzleDay01::PuzzleDay01(const std::string_view input)
     : pImpl(std::make_unique<PuzzleDay01Impl>(ParseToVectorOfNums<int, '\n'>(input)))
 {
@@ -73,20 +112,205 @@ PuzzleDay01::~PuzzleDay01() = default;
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay01::Part1()
 {
-    if (!pImpl || (pImpl->GetDataSize() < 2))
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay01::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<1>(const std::string_view input)
+{
+    PuzzleDay01Impl impl{ParseToVectorOfNums<int, '\n'>(input)};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+std::int64_t CountDepthIncreases(const std::span<const int> depths, const std::size_t windowSize_)
+{
+    return CountWindowIncreases(depths, windowSize_);
+}
+
+SonarMonitor::SonarMonitor(const std::span<const std::size_t> windowSizes)
+{
+    std::size_t maxWindowSize = 0u;
+    for (const auto size : windowSizes)
+    {
+        windows.push_back({.size = size, .increases = 0});
+        maxWindowSize = std::max(maxWindowSize, size);
+    }
+    history.resize(maxWindowSize);
+}
+
+void SonarMonitor::Push(const int depth)
+{
+    const auto historySize = history.size();
+    for (auto &window : windows)
+    {
+        // the sample leaving the window is the one pushed window.size samples ago
+        if ((window.size != 0u) && (numSamples >= window.size) &&
+            (depth > history[(historyHead + historySize - window.size) % historySize]))
+        {
+            ++window.increases;
+        }
+    }
+    if (historySize != 0u)
+    {
+        history[historyHead] = depth;
+        historyHead = (historyHead + 1u) % historySize;
+    }
+    ++numSamples;
+}
+
+void SonarMonitor::Push(const std::span<const int> depths)
+{
+    for (const auto depth : depths)
+    {
+        Push(depth);
+    }
+}
+
+std::optional<std::int64_t> SonarMonitor::GetIncreases(const std::size_t size) const
+{
+    const auto window = std::find_if(windows.begin(), windows.end(), [size](const auto &w) { return w.size == size; });
+    if (window == windows.end())
+    {
+        return std::nullopt;
+    }
+    return window->increases;
+}
+
+std::uint64_t SonarMonitor::GetNumSamples() const
+{
+    return numSamples;
+}
+
+class PuzzleDay01OptimizedImpl final
+{
+  public:
+    explicit PuzzleDay01OptimizedImpl(const std::string_view input) : monitor(monitoredWindowSizes)
+    {
+        ParseLines(
+            input,
+            [this](const std::string_view line) {
+                monitor.Push(ParseNumber<int>(line));
+                return true;
+            },
+            false);
+    }
+
+  public:
+    static constexpr std::array<std::size_t, 2> monitoredWindowSizes = {1u, windowSize};
+    SonarMonitor monitor;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(01, Optimized)
+
+PuzzleDay01Optimized::PuzzleDay01Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay01OptimizedImpl>(input))
+{
+}
+
+PuzzleDay01Optimized::~PuzzleDay01Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay01Optimized::Part1()
+{
+    if (pImpl->monitor.GetNumSamples() < 2u)
     {
         return std::monostate{};
     }
-    return pImpl->Part01();
+    return pImpl->monitor.GetIncreases(1u).value();
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay01::Part2()
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay01Optimized::Part2()
 {
-    if (!pImpl || (pImpl->GetDataSize() <= windowSize))
+    if (pImpl->monitor.GetNumSamples() <= windowSize)
     {
         return std::monostate{};
     }
-    return pImpl->Part02();
+    return pImpl->monitor.GetIncreases(windowSize).value();
+}
+
+/// Splits the input at line boundaries into chunks which are parsed and counted in parallel. Only the comparisons
+/// which straddle a chunk boundary, i.e. the ones of the last (window size) samples before it, are counted afterwards.
+class PuzzleDay01ParallelImpl final
+{
+  public:
+    explicit PuzzleDay01ParallelImpl(const std::string_view input)
+    {
+        const auto chunks = SplitAtLineBoundaries(input, minChunkSize);
+        std::vector<std::vector<int>> chunkMeasurements(chunks.size());
+        std::vector<std::array<std::int64_t, numWindows>> chunkIncreases(chunks.size());
+        ParallelFor(chunks.size(), [&](const std::size_t chunk) {
+            chunkMeasurements[chunk] = ParseToVectorOfNums<int, '\n'>(chunks[chunk]);
+            for (std::size_t window = 0; window != numWindows; ++window)
+            {
+                chunkIncreases[chunk][window] = CountWindowIncreases(chunkMeasurements[chunk], windowSizes[window]);
+            }
+        });
+
+        constexpr std::size_t maxWindowSize = std::max(windowSizes[0], windowSizes[1]);
+        std::vector<int> carry; // last samples before the current chunk boundary
+        std::vector<int> seam;
+        for (std::size_t chunk = 0; chunk != chunks.size(); ++chunk)
+        {
+            const auto &measurements = chunkMeasurements[chunk];
+            seam = carry;
+            const auto seamEnd = std::min(maxWindowSize, measurements.size());
+            seam.insert(seam.end(), measurements.begin(), measurements.begin() + static_cast<std::ptrdiff_t>(seamEnd));
+            for (std::size_t window = 0; window != numWindows; ++window)
+            {
+                increases[window] += chunkIncreases[chunk][window];
+                const auto size = windowSizes[window];
+                // compare samples left of the boundary to the ones right of it
+                for (std::size_t i = (carry.size() > size) ? (carry.size() - size) : 0u;
+                     (i < carry.size()) && ((i + size) < seam.size()); ++i)
+                {
+                    increases[window] += static_cast<std::int64_t>(seam[i + size] > seam[i]);
+                }
+            }
+            carry.insert(carry.end(), measurements.begin(), measurements.end());
+            if (carry.size() > maxWindowSize)
+            {
+                carry.erase(carry.begin(), carry.end() - static_cast<std::ptrdiff_t>(maxWindowSize));
+            }
+            numMeasurements += measurements.size();
+        }
+    }
+
+  public:
+    static constexpr std::size_t minChunkSize = 64u * 1024u;
+    static constexpr std::size_t numWindows = 2u;
+    static constexpr std::array<std::size_t, numWindows> windowSizes = {1u, windowSize};
+    std::array<std::int64_t, numWindows> increases{};
+    std::size_t numMeasurements{0};
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(01, Parallel)
+
+PuzzleDay01Parallel::PuzzleDay01Parallel(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay01ParallelImpl>(input))
+{
+}
+
+PuzzleDay01Parallel::~PuzzleDay01Parallel() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay01Parallel::Part1()
+{
+    if (pImpl->numMeasurements < 2u)
+    {
+        return std::monostate{};
+    }
+    return pImpl->increases[0];
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay01Parallel::Part2()
+{
+    if (pImpl->numMeasurements <= windowSize)
+    {
+        return std::monostate{};
+    }
+    return pImpl->increases[1];
 }
 
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
@@ -109,6 +333,14 @@ consteval bool TestDay01()
 }
 
 static_assert(TestDay01(), "");
+
+constexpr std::array<int, 10> exampleMeasurements = {
+    199, 200, 208, 210, 200, 207, 240, 269, 260, 263,
+};
+static_assert(CountWindowIncreases(exampleMeasurements, 0u) == 0);
+static_assert(CountWindowIncreases(exampleMeasurements, 2u) == 5);
+static_assert(CountWindowIncreases(exampleMeasurements, 9u) == 1);
+static_assert(CountWindowIncreases(exampleMeasurements, 10u) == 0);
 } // namespace
 #endif // AOC_Y2021_CONSTEXPR_UNIT_TEST
 
@@ -1,111 +1,144 @@
 #include "ipuzzle.hpp"
+#include "parallel_utils.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <numeric>
 #include <string_view>
 #include <vector>
 
 namespace AOC::Y2021
 {
 
-class PuzzleDay02Impl final
+namespace
 {
-  public:
-    explicit AOC_Y2021_CONSTEXPR PuzzleDay02Impl(std::string_view writtenInstructions)
+
+/// Submarine state after executing commands from the origin. The depth of part 1 equals the aim of part 2, so a single
+/// pass over the commands serves both parts.
+struct Course
+{
+    std::int64_t horizontal;
+    std::int64_t aim;
+    std::int64_t depth;
+    std::size_t numCommands;
+    bool bStoppedAtInvalidLine;
+};
+
+/// Parses and executes the commands in one pass, dispatching on the first character of each line. Stops at the first
+/// line which is not a command.
+AOC_Y2021_CONSTEXPR Course ExecuteCommands(std::string_view commands)
+{
+    constexpr std::size_t forwardLength = std::string_view{"forward"}.size();
+    constexpr std::size_t downLength = std::string_view{"down"}.size();
+    constexpr std::size_t upLength = std::string_view{"up"}.size();
+    const auto parseValue = [&commands](const std::size_t commandLength) {
+        return ParseNumber<std::int64_t>(commands.substr(std::min(commandLength, commands.size())));
+    };
+    Course course{};
+    while (!commands.empty())
     {
-        auto inputSize = writtenInstructions.size();
-        while (inputSize > 4u)
+        switch (commands.front())
         {
-            const auto valuePos = writtenInstructions.find(' ');
-            const auto value = ParseNumber<int>(writtenInstructions.substr(valuePos));
-            if (writtenInstructions.starts_with("forward"))
-            {
-                instructions.push_back({.forward = value, .down = 0});
-            }
-            else if (writtenInstructions.starts_with("up"))
-            {
-                instructions.push_back({.forward = 0, .down = -value});
-            }
-            else if (writtenInstructions.starts_with("down"))
-            {
-                instructions.push_back({.forward = 0, .down = value});
-            }
-            else
-            {
-                break;
-            }
+        case 'f': {
+            const auto value = parseValue(forwardLength);
+            course.horizontal += value;
+            course.depth += course.aim * value;
+            break;
+        }
+        case 'd':
+            course.aim += parseValue(downLength);
+            break;
+        case 'u':
+            course.aim -= parseValue(upLength);
+            break;
+        default:
+            course.bStoppedAtInvalidLine = true;
+            return course;
+        }
+        ++course.numCommands;
 
-            const auto endOfLine = writtenInstructions.find('\n');
-            if (endOfLine == writtenInstructions.npos)
-            {
-                break;
-            }
-            const auto startOfNextLine = endOfLine + 1u;
-            if (startOfNextLine >= inputSize)
-            {
-                break;
-            }
-            writtenInstructions.remove_prefix(startOfNextLine);
-            inputSize = writtenInstructions.size();
+        const auto endOfLine = commands.find('\n');
+        if (endOfLine == commands.npos)
+        {
+            break;
         }
+        commands.remove_prefix(endOfLine + 1u);
     }
+    return course;
+}
+
+/// Course of the commands of first followed by the ones of second. Turning does not depend on the position, and moving
+/// forward by x adds aim * x to the depth, so the courses compose like affine maps and chunks of commands can be
+/// executed independently.
+AOC_Y2021_CONSTEXPR Course Concatenate(const Course &first, const Course &second)
+{
+    return {
+        .horizontal = first.horizontal + second.horizontal,
+        .aim = first.aim + second.aim,
+        .depth = first.depth + second.depth + (first.aim * second.horizontal),
+        .numCommands = first.numCommands + second.numCommands,
+        .bStoppedAtInvalidLine = second.bStoppedAtInvalidLine,
+    };
+}
 
-    AOC_Y2021_CONSTEXPR std::int64_t Part01()
+} // namespace
+
+class PuzzleDay02Impl final
+{
+  public:
+    explicit AOC_Y2021_CONSTEXPR PuzzleDay02Impl(std::string_view writtenInstructions)
+        : course(ExecuteCommands(writtenInstructions))
     {
-        const Position startPos{0, 0};
-        const auto endPos =
-            std::accumulate(instructions.begin(), instructions.end(), startPos, [](Position sum, const auto &other) {
-                return Position{sum.horizontal + other.forward, sum.depth + other.down};
-            });
-        const auto result = endPos.depth * endPos.horizontal;
-        return result;
     }
 
-    AOC_Y2021_CONSTEXPR std::int64_t Part02()
+    AOC_Y2021_CONSTEXPR std::int64_t Part01() const
     {
-        int aim = 0;
-        Position pos{.horizontal = 0, .depth = 0};
-        for (const auto &instruction : instructions)
-        {
-            if (instruction.forward != 0)
-            {
-                pos.horizontal += instruction.forward;
-                pos.depth += aim * instruction.forward;
-            }
-            else
-            {
-                aim += instruction.down;
-            }
-        }
-        const auto result = pos.depth * pos.horizontal;
-        return result;
+        return course.horizontal * course.aim;
     }
 
-    auto GetDataSize() const
+    AOC_Y2021_CONSTEXPR std::int64_t Part02() const
     {
-        return instructions.size();
+        return course.horizontal * course.depth;
     }
 
-  private:
-    struct Position
-    {
-        int horizontal;
-        int depth;
-    };
-    struct Instruction
+    auto GetDataSize() const
     {
-        int forward;
-        int down;
-    };
+        return course.numCommands;
+    }
 
   private:
-    std::vector<Instruction> instructions;
+    Course course;
 };
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(02)
 
+namespace
+{
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay02Impl &impl)
+{
+    if (impl.GetDataSize() < 2)
+    {
+        return std::monostate{};
+    }
+    return impl.Part01();
+}
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay02Impl &impl)
+{
+    if (impl.GetDataSize() <= 2)
+    {
+        return std::monostate{};
+    }
+    return impl.Part02();
+}
+
+} // namespace
+
 PuzzleDay02::PuzzleDay02(const std::string_view input) : pImpl(std::make_unique<PuzzleDay02Impl>(input))
 {
 }
@@ -114,20 +147,70 @@ PuzzleDay02::~PuzzleDay02() = default;
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay02::Part1()
 {
-    if (!pImpl || (pImpl->GetDataSize() < 2))
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay02::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<2>(const std::string_view input)
+{
+    PuzzleDay02Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+/// Executes chunks of the commands in parallel and concatenates their courses in order.
+class PuzzleDay02ParallelImpl final
+{
+  public:
+    explicit PuzzleDay02ParallelImpl(const std::string_view input)
+    {
+        const auto chunks = SplitAtLineBoundaries(input, minChunkSize);
+        std::vector<Course> chunkCourses(chunks.size());
+        ParallelFor(chunks.size(),
+                    [&](const std::size_t chunk) { chunkCourses[chunk] = ExecuteCommands(chunks[chunk]); });
+        for (const auto &chunkCourse : chunkCourses)
+        {
+            course = Concatenate(course, chunkCourse);
+            if (chunkCourse.bStoppedAtInvalidLine)
+            {
+                break;
+            }
+        }
+    }
+
+  public:
+    static constexpr std::size_t minChunkSize = 64u * 1024u;
+    Course course{};
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(02, Parallel)
+
+PuzzleDay02Parallel::PuzzleDay02Parallel(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay02ParallelImpl>(input))
+{
+}
+
+PuzzleDay02Parallel::~PuzzleDay02Parallel() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay02Parallel::Part1()
+{
+    if (pImpl->course.numCommands < 2)
     {
         return std::monostate{};
     }
-    return pImpl->Part01();
+    return pImpl->course.horizontal * pImpl->course.aim;
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay02::Part2()
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay02Parallel::Part2()
 {
-    if (!pImpl || (pImpl->GetDataSize() <= 2))
+    if (pImpl->course.numCommands <= 2)
     {
         return std::monostate{};
     }
-    return pImpl->Part02();
+    return pImpl->course.horizontal * pImpl->course.depth;
 }
 
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
@@ -152,6 +235,17 @@ consteval bool TestDay02Part2()
 }
 static_assert(TestDay02Part2(), "Day 02 Part 2 failed");
 
+consteval bool TestDay02Concatenate()
+{
+    const auto course = ExecuteCommands(exampleInput);
+    const auto splitPos = exampleInput.find("up");
+    const auto concatenated =
+        Concatenate(ExecuteCommands(exampleInput.substr(0, splitPos)), ExecuteCommands(exampleInput.substr(splitPos)));
+    return (course.horizontal == concatenated.horizontal) && (course.aim == concatenated.aim) &&
+           (course.depth == concatenated.depth) && (course.numCommands == concatenated.numCommands);
+}
+static_assert(TestDay02Concatenate(), "Day 02: concatenated courses differ");
+
 } // namespace
 #endif // AOC_Y2021_CONSTEXPR_UNIT_TEST
 } // namespace AOC::Y2021
@@ -1,13 +1,20 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <ranges>
+#include <span>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace AOC::Y2021
@@ -43,6 +50,11 @@ AOC_Y2021_CONSTEXPR std::vector<uint32_t> ParseInput(std::string_view input)
 
 AOC_Y2021_CONSTEXPR std::int64_t CalculatePowerConsumption(const std::vector<uint32_t> &input)
 {
+    if (input[0u] > 32u)
+    {
+        // the rates would not fit into 32 bit, and shifting by 32 or more is undefined
+        return -__LINE__;
+    }
     const auto patternLen = input[0u];
     const auto inputCnt = input.size() - 1u;
     uint32_t gamma = 0u;
@@ -57,74 +69,333 @@ AOC_Y2021_CONSTEXPR std::int64_t CalculatePowerConsumption(const std::vector<uin
             gamma |= 1u << index;
         }
     }
-    const uint32_t epsilon = (~gamma) & ((1u << patternLen) - 1u);
-    return gamma * epsilon;
+    const uint32_t epsilon = (~gamma) & ((patternLen == 32u) ? ~0u : ((1u << patternLen) - 1u));
+    return std::int64_t{gamma} * std::int64_t{epsilon};
+}
+
+/// Stable LSD radix sort of the report numbers, one pass per 8 bits of the pattern length
+AOC_Y2021_CONSTEXPR void RadixSort(std::vector<uint32_t> &numbers, const std::uint32_t patternLen)
+{
+    std::vector<uint32_t> sorted(numbers.size());
+    for (std::uint32_t shift = 0; shift < patternLen; shift += 8u)
+    {
+        std::array<std::size_t, 257u> offsets{};
+        for (const auto number : numbers)
+        {
+            ++offsets[((number >> shift) & 0xFFu) + 1u];
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        for (const auto number : numbers)
+        {
+            sorted[offsets[(number >> shift) & 0xFFu]++] = number;
+        }
+        numbers.swap(sorted);
+    }
 }
 
+/// Sorts the report once. Numbers that survived the filtering of the higher bits share their prefix, so they form a
+/// contiguous range [lo, hi) of the sorted report, which the next bit partitions into cleared and set bits.
 AOC_Y2021_CONSTEXPR std::int64_t CalculateLifeSupportRating(const std::vector<uint32_t> &input)
 {
-    if (input.size() < 3)
+    if ((input.size() < 3) || (input[0u] > 32u))
     {
         return -__LINE__;
     }
-    enum BitCriteria
-    {
-        BIT_CRITERIA_MOST_COMMON,
-        BIT_CRITERIA_LEAST_COMMON,
-        BIT_CRITERIA_COUNT,
-    };
-    auto fnFilterRating = [&input](BitCriteria bitCriteria) -> std::optional<std::uint32_t> {
-        if (input.size() < 2)
+    const auto patternLen = input[0u];
+    std::vector sorted(input.begin() + 1, input.end());
+    RadixSort(sorted, patternLen);
+    auto fnFilterRating = [&sorted, patternLen](const bool bLookForMostCommon) -> std::optional<std::uint32_t> {
+        auto lo = sorted.begin();
+        auto hi = sorted.end();
+        for (auto bitPos = patternLen; (bitPos != 0u) && ((hi - lo) > 1); --bitPos)
         {
-            return std::nullopt;
-        }
-        const bool bLookForMostCommon = (bitCriteria == BIT_CRITERIA_MOST_COMMON) ? true : false;
-        const auto patternLen = input[0u];
-        auto bitPos = patternLen - 1u;
-        std::vector filtered(input.begin() + 1, input.end());
-        while (filtered.size() > 1)
-        {
-            const auto bitMask = 1ul << bitPos;
-            const auto numOfSetBits = static_cast<size_t>(
-                std::ranges::count_if(filtered, [&bitMask](const auto &i) -> bool { return (i & bitMask); }));
-            const auto numOfClearedBits = filtered.size() - numOfSetBits;
-            const std::uint32_t commonBit =
+            const auto bitMask = std::uint32_t{1} << (bitPos - 1u);
+            const auto mid = std::partition_point(lo, hi, [bitMask](const auto n) { return (n & bitMask) == 0u; });
+            const auto numOfSetBits = hi - mid;
+            const auto numOfClearedBits = mid - lo;
+            const bool bKeepSetBits =
                 bLookForMostCommon ? (numOfSetBits >= numOfClearedBits) : (numOfSetBits < numOfClearedBits);
-            std::erase_if(filtered,
-                          [commonBit, bitPos](const auto &n) { return (((n >> bitPos) & 0b1u) != commonBit); });
-            /* not supported by clang 12
-            filtered = filtered | std::ranges::views::filter([commonBit, bitPos](const auto &n) {
-                return (((n >> bitPos) & 0b1u) != commonBit);
-            });
-            */
-            if (bitPos == 0)
+            if (bKeepSetBits)
             {
-                break;
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
             }
-            bitPos--;
-
-            // filtered = filtered | std:git :ranges::views::filter([]
         }
-        if (filtered.size() != 1)
+        if ((hi - lo) != 1)
         {
             return std::nullopt;
         }
-        return filtered[0u];
+        return *lo;
     };
-    const auto oxygenRating = fnFilterRating(BIT_CRITERIA_MOST_COMMON);
+    const auto oxygenRating = fnFilterRating(true);
     if (!oxygenRating.has_value())
     {
         return -__LINE__;
     }
-    const auto CO2Rating = fnFilterRating(BIT_CRITERIA_LEAST_COMMON);
+    const auto CO2Rating = fnFilterRating(false);
     if (!CO2Rating.has_value())
     {
         return -__LINE__;
     }
-    const auto lifeSupportRating = oxygenRating.value() * CO2Rating.value();
+    const auto lifeSupportRating =
+        static_cast<std::int64_t>(oxygenRating.value()) * static_cast<std::int64_t>(CO2Rating.value());
     return lifeSupportRating;
 }
 
+/// Diagnostic report of arbitrary width. Each row is stored as numWords 64 bit words, least significant word first, so
+/// bit b of a row is the character (width - 1 - b) of its line.
+class WideReport final
+{
+  public:
+    explicit WideReport(const std::string_view input)
+    {
+        bool bValid = true;
+        ParseLines(input, [this, &bValid](const std::string_view line) {
+            if (width == 0u)
+            {
+                width = line.size();
+                numWords = (width + 63u) / 64u;
+            }
+            if (line.size() != width)
+            {
+                bValid = false;
+                return false;
+            }
+            const auto rowStart = words.size();
+            words.resize(rowStart + numWords, 0u);
+            for (std::size_t bit = 0; bit != width; ++bit)
+            {
+                const char c = line[width - 1u - bit];
+                if ((c != '0') && (c != '1'))
+                {
+                    bValid = false;
+                    return false;
+                }
+                words[rowStart + (bit / 64u)] |= static_cast<std::uint64_t>(c - '0') << (bit % 64u);
+            }
+            ++numRows;
+            return true;
+        });
+        if (!bValid)
+        {
+            width = numWords = numRows = 0u;
+            words.clear();
+        }
+    }
+
+    [[nodiscard]] std::span<const std::uint64_t> Row(const std::size_t row) const
+    {
+        return std::span(words).subspan(row * numWords, numWords);
+    }
+
+  public:
+    std::size_t width{0};
+    std::size_t numWords{0};
+    std::size_t numRows{0};
+
+  private:
+    std::vector<std::uint64_t> words;
+};
+
+/// carry-save adder: adds the three bit vectors a, b and c column by column into the sum and carry bits
+constexpr void CarrySaveAdd(std::uint64_t &carry, std::uint64_t &sum, const std::uint64_t a, const std::uint64_t b,
+                            const std::uint64_t c)
+{
+    const auto halfSum = a ^ b;
+    carry = (a & b) | (halfSum & c);
+    sum = halfSum ^ c;
+}
+
+/// Counts the set bits of every column in a single pass over the report. Per 64 bit word, the counts of all 64 columns
+/// are kept bit-sliced in vertical counters: plane k holds bit k of every column's count. Blocks of 16 rows are added
+/// by a Harley-Seal tree of carry-save adders into the planes of weight 1, 2, 4 and 8, which leaves one word of weight
+/// 16 per block to be ripple-carried into the higher planes. The planes are flushed into the column counts before they
+/// can overflow.
+std::vector<std::uint64_t> CountSetBitsPerColumn(const WideReport &report)
+{
+    constexpr std::size_t numPlanes = 16u;
+    constexpr std::size_t maxCount = (std::size_t{1} << numPlanes) - 1u;
+    constexpr std::size_t blockRows = 16u;
+    std::vector<std::uint64_t> columnCounts(report.numWords * 64u, 0u);
+    std::vector<std::array<std::uint64_t, numPlanes>> planes(report.numWords);
+    const auto flush = [&]() {
+        for (std::size_t word = 0; word != report.numWords; ++word)
+        {
+            for (std::size_t plane = 0; plane != numPlanes; ++plane)
+            {
+                for (std::size_t bit = 0; bit != 64u; ++bit)
+                {
+                    columnCounts[(word * 64u) + bit] += ((planes[word][plane] >> bit) & 1u) << plane;
+                }
+                planes[word][plane] = 0u;
+            }
+        }
+    };
+    const auto rippleCarry = [](std::array<std::uint64_t, numPlanes> &wordPlanes, std::size_t plane,
+                                std::uint64_t carry) {
+        for (; carry != 0u; ++plane)
+        {
+            const std::uint64_t nextCarry = wordPlanes[plane] & carry;
+            wordPlanes[plane] ^= carry;
+            carry = nextCarry;
+        }
+    };
+    std::size_t numUnflushedRows = 0u;
+    std::size_t row = 0;
+    for (; (row + blockRows) <= report.numRows; row += blockRows)
+    {
+        if ((numUnflushedRows + blockRows) > maxCount)
+        {
+            flush();
+            numUnflushedRows = 0u;
+        }
+        for (std::size_t word = 0; word != report.numWords; ++word)
+        {
+            const auto fnRow = [&report, row, word](const std::size_t i) { return report.Row(row + i)[word]; };
+            auto &ones = planes[word][0];
+            auto &twos = planes[word][1];
+            auto &fours = planes[word][2];
+            auto &eights = planes[word][3];
+            std::uint64_t twosA{}, twosB{}, foursA{}, foursB{}, eightsA{}, eightsB{}, sixteens{};
+            CarrySaveAdd(twosA, ones, ones, fnRow(0u), fnRow(1u));
+            CarrySaveAdd(twosB, ones, ones, fnRow(2u), fnRow(3u));
+            CarrySaveAdd(foursA, twos, twos, twosA, twosB);
+            CarrySaveAdd(twosA, ones, ones, fnRow(4u), fnRow(5u));
+            CarrySaveAdd(twosB, ones, ones, fnRow(6u), fnRow(7u));
+            CarrySaveAdd(foursB, twos, twos, twosA, twosB);
+            CarrySaveAdd(eightsA, fours, fours, foursA, foursB);
+            CarrySaveAdd(twosA, ones, ones, fnRow(8u), fnRow(9u));
+            CarrySaveAdd(twosB, ones, ones, fnRow(10u), fnRow(11u));
+            CarrySaveAdd(foursA, twos, twos, twosA, twosB);
+            CarrySaveAdd(twosA, ones, ones, fnRow(12u), fnRow(13u));
+            CarrySaveAdd(twosB, ones, ones, fnRow(14u), fnRow(15u));
+            CarrySaveAdd(foursB, twos, twos, twosA, twosB);
+            CarrySaveAdd(eightsB, fours, fours, foursA, foursB);
+            CarrySaveAdd(sixteens, eights, eights, eightsA, eightsB);
+            rippleCarry(planes[word], 4u, sixteens);
+        }
+        numUnflushedRows += blockRows;
+    }
+    for (; row != report.numRows; ++row)
+    {
+        if (numUnflushedRows == maxCount)
+        {
+            flush();
+            numUnflushedRows = 0u;
+        }
+        const auto rowWords = report.Row(row);
+        for (std::size_t word = 0; word != report.numWords; ++word)
+        {
+            rippleCarry(planes[word], 0u, rowWords[word]);
+        }
+        ++numUnflushedRows;
+    }
+    flush();
+    return columnCounts;
+}
+
+/// Multiplies two multi-word numbers. The product is returned as integer if it fits into std::int64_t, as decimal
+/// string otherwise.
+IPuzzle::Solution_t MultiplyWide(const std::span<const std::uint64_t> lhs, const std::span<const std::uint64_t> rhs)
+{
+    const auto toLimbs = [](const std::span<const std::uint64_t> words) {
+        std::vector<std::uint32_t> limbs;
+        for (const auto word : words)
+        {
+            limbs.push_back(static_cast<std::uint32_t>(word));
+            limbs.push_back(static_cast<std::uint32_t>(word >> 32u));
+        }
+        return limbs;
+    };
+    auto product = MultiplyLimbs(toLimbs(lhs), toLimbs(rhs));
+    if ((product.size() <= 1u) || ((product.size() == 2u) && (product[1] <= INT32_MAX)))
+    {
+        const std::uint64_t low = product.empty() ? 0u : product[0];
+        const std::uint64_t high = (product.size() == 2u) ? product[1] : 0u;
+        return static_cast<std::int64_t>((high << 32u) | low);
+    }
+    return ToDecimalString(std::move(product));
+}
+
+IPuzzle::Solution_t CalculateWidePowerConsumption(const WideReport &report)
+{
+    if (report.numRows < 1u)
+    {
+        return std::monostate{};
+    }
+    const auto columnCounts = CountSetBitsPerColumn(report);
+    std::vector<std::uint64_t> gamma(report.numWords, 0u);
+    std::vector<std::uint64_t> epsilon(report.numWords, 0u);
+    for (std::size_t bit = 0; bit != report.width; ++bit)
+    {
+        const auto mask = std::uint64_t{1} << (bit % 64u);
+        if ((2u * columnCounts[bit]) > report.numRows)
+        {
+            gamma[bit / 64u] |= mask;
+        }
+        else
+        {
+            epsilon[bit / 64u] |= mask;
+        }
+    }
+    return MultiplyWide(gamma, epsilon);
+}
+
+/// Same filtering as CalculateLifeSupportRating for reports of any width: the row indices are sorted once by the value
+/// of their rows, so the rows sharing the already filtered prefix form a contiguous range.
+IPuzzle::Solution_t CalculateWideLifeSupportRating(const WideReport &report)
+{
+    if (report.numRows < 2u)
+    {
+        return std::monostate{};
+    }
+    std::vector<std::size_t> sortedRows(report.numRows);
+    std::iota(sortedRows.begin(), sortedRows.end(), std::size_t{0});
+    std::ranges::sort(sortedRows, [&report](const std::size_t lhs, const std::size_t rhs) {
+        const auto lhsWords = report.Row(lhs);
+        const auto rhsWords = report.Row(rhs);
+        return std::lexicographical_compare(lhsWords.rbegin(), lhsWords.rend(), rhsWords.rbegin(), rhsWords.rend());
+    });
+    auto fnFilterRating = [&report, &sortedRows](const bool bLookForMostCommon) -> std::optional<std::size_t> {
+        auto lo = sortedRows.begin();
+        auto hi = sortedRows.end();
+        for (auto bitPos = report.width; (bitPos != 0u) && ((hi - lo) > 1); --bitPos)
+        {
+            const auto word = (bitPos - 1u) / 64u;
+            const auto bitMask = std::uint64_t{1} << ((bitPos - 1u) % 64u);
+            const auto mid = std::partition_point(
+                lo, hi, [&report, word, bitMask](const auto row) { return (report.Row(row)[word] & bitMask) == 0u; });
+            const auto numOfSetBits = hi - mid;
+            const auto numOfClearedBits = mid - lo;
+            const bool bKeepSetBits =
+                bLookForMostCommon ? (numOfSetBits >= numOfClearedBits) : (numOfSetBits < numOfClearedBits);
+            if (bKeepSetBits)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        if ((hi - lo) != 1)
+        {
+            return std::nullopt;
+        }
+        return *lo;
+    };
+    const auto oxygenRow = fnFilterRating(true);
+    const auto CO2Row = fnFilterRating(false);
+    if (!oxygenRow.has_value() || !CO2Row.has_value())
+    {
+        return std::monostate{};
+    }
+    return MultiplyWide(report.Row(oxygenRow.value()), report.Row(CO2Row.value()));
+}
+
 } // namespace
 
 class PuzzleDay03Impl final
@@ -140,28 +411,30 @@ class PuzzleDay03Impl final
 };
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(03)
 
-PuzzleDay03::PuzzleDay03(const std::string_view input) : pImpl(std::make_unique<PuzzleDay03Impl>(input))
+namespace
 {
-}
-
-PuzzleDay03::~PuzzleDay03() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay03::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay03Impl &impl)
 {
-    if (!pImpl || (pImpl->parsedInput.size() < 2))
+    if (impl.parsedInput.size() < 2)
     {
         return std::monostate{};
     }
-    return CalculatePowerConsumption(pImpl->parsedInput);
+    const auto powerConsumption = CalculatePowerConsumption(impl.parsedInput);
+    if (powerConsumption < 0)
+    {
+        return std::monostate{};
+    }
+    return powerConsumption;
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay03::Part2()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay03Impl &impl)
 {
-    if (!pImpl || (pImpl->parsedInput.size() <= 2))
+    if (impl.parsedInput.size() <= 2)
     {
         return std::monostate{};
     }
-    const auto lifeSupportRating = CalculateLifeSupportRating(pImpl->parsedInput);
+    const auto lifeSupportRating = CalculateLifeSupportRating(impl.parsedInput);
     if (lifeSupportRating < 0)
     {
         return std::monostate{};
@@ -169,6 +442,61 @@ PuzzleDay03::~PuzzleDay03() = default;
     return lifeSupportRating;
 }
 
+} // namespace
+
+PuzzleDay03::PuzzleDay03(const std::string_view input) : pImpl(std::make_unique<PuzzleDay03Impl>(input))
+{
+}
+
+PuzzleDay03::~PuzzleDay03() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay03::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay03::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<3>(const std::string_view input)
+{
+    PuzzleDay03Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+class PuzzleDay03OptimizedImpl final
+{
+
+  public:
+    explicit PuzzleDay03OptimizedImpl(std::string_view input) : report(input)
+    {
+    }
+
+  public:
+    WideReport report;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(03, Optimized)
+
+PuzzleDay03Optimized::PuzzleDay03Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay03OptimizedImpl>(input))
+{
+}
+
+PuzzleDay03Optimized::~PuzzleDay03Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay03Optimized::Part1()
+{
+    return CalculateWidePowerConsumption(pImpl->report);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay03Optimized::Part2()
+{
+    return CalculateWideLifeSupportRating(pImpl->report);
+}
+
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
 namespace
 {
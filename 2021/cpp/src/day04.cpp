@@ -1,14 +1,21 @@
 #include "ipuzzle.hpp"
+#include "parallel_utils.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace AOC::Y2021
@@ -16,143 +23,99 @@ namespace AOC::Y2021
 
 namespace
 {
-class BingoGame
+/// Drawn numbers and boards of a bingo game. The boards are square and stored flat, boardSize * boardSize numbers per
+/// board in row-major order.
+struct BingoInput
 {
-  private:
-    class Board
-    {
-      public:
-        constexpr static auto numLines = 5;
-        constexpr static auto numsPerLine = 5;
-        struct Number
-        {
-            std::uint8_t num : 7u;
-            std::uint8_t drawn : 1u;
-        };
-        static_assert(sizeof(Number) == 1, "");
+    constexpr static std::size_t maxBoardSize = 64u;
+    std::vector<std::uint32_t> draws;
+    std::size_t boardSize{0};
+    std::vector<std::uint32_t> cells;
+};
 
-      public:
-        AOC_Y2021_CONSTEXPR std::optional<uint32_t> MarkNumber(const uint8_t number)
-        {
-            for (auto &row : aaNums)
-            {
-                for (auto &num : row)
-                {
-                    if (num.num == number)
-                    {
-                        num.drawn = 1;
-                    }
-                }
-            }
-            auto fnIsHorizontalBingo = [this]() -> bool {
-                return std::ranges::any_of(aaNums, [](const auto &row) -> bool {
-                    return std::ranges::all_of(row, [](const auto &n) { return n.drawn != 0; });
-                });
-            };
-            auto fnVerticalRowBingo = [this]() -> bool {
-                for (size_t col = 0; col < aaNums[0u].size(); col++)
-                {
-                    bool bIsColBingo = true;
-                    for (size_t row = 0u; row != aaNums.size(); row++)
-                    {
-                        if (aaNums[row][col].drawn == 0)
-                        {
-                            bIsColBingo = false;
-                            break;
-                        }
-                    }
-                    if (bIsColBingo)
-                    {
-                        return true;
-                    }
-                }
-                return false;
-            };
-            if (fnIsHorizontalBingo() || fnVerticalRowBingo())
-            {
-                const auto sumOfUnmarkedNums =
-                    std::accumulate(aaNums.begin(), aaNums.end(), 0U, [](const auto acc, const auto &row) {
-                        return acc + std::accumulate(row.begin(), row.end(), 0U, [](const auto acc, const auto &n) {
-                                   return acc + (n.drawn ? 0 : n.num);
-                               });
-                    });
-                const auto score = sumOfUnmarkedNums * number;
-                return score;
-            }
-            else
-            {
-                return std::nullopt;
-            }
-        }
+/// The sum of up to 64 * 64 unmarked 32 bit numbers times a 32 bit number needs up to 76 bit
+using BingoScore = CheckedUInt128;
 
-      public:
-        std::array<std::array<Number, numsPerLine>, numLines> aaNums{};
-    };
+AOC_Y2021_CONSTEXPR BingoScore CalculateScore(const std::uint64_t sumOfUnmarkedNums, const std::uint32_t number)
+{
+    return BingoScore::FromUInt64(sumOfUnmarkedNums) * BingoScore::FromUInt64(number);
+}
+
+struct BingoScores
+{
+    std::optional<BingoScore> first;
+    std::optional<BingoScore> last;
+};
 
+/// The board size is the count of numbers in the first board line. Trailing incomplete boards are dropped, boards
+/// larger than maxBoardSize are rejected.
+AOC_Y2021_CONSTEXPR BingoInput ParseBingoInput(std::string_view input)
+{
+    BingoInput bingo;
+    const auto endOfFirstLine = input.find('\n');
+    if (endOfFirstLine == input.npos)
+    {
+        return bingo;
+    }
+    bingo.draws = ParseToVectorOfNums<std::uint32_t, ','>(input.substr(0, endOfFirstLine));
+    input.remove_prefix(endOfFirstLine);
+    constexpr std::string_view whitespaceChars = "\t\r\n ";
+    constexpr std::string_view blankChars = "\t ";
+    const auto startOfFirstBoard = input.find_first_not_of(whitespaceChars);
+    if (startOfFirstBoard == input.npos)
+    {
+        return bingo;
+    }
+    auto firstBoardLine = input.substr(startOfFirstBoard);
+    firstBoardLine = firstBoardLine.substr(0, firstBoardLine.find_first_of("\r\n"));
+    for (auto start = firstBoardLine.find_first_not_of(blankChars); start != firstBoardLine.npos;
+         start = firstBoardLine.find_first_not_of(blankChars, firstBoardLine.find_first_of(blankChars, start)))
+    {
+        ++bingo.boardSize;
+    }
+    if (bingo.boardSize > BingoInput::maxBoardSize)
+    {
+        bingo.boardSize = 0u;
+        return bingo;
+    }
+    for (auto start = input.find_first_not_of(whitespaceChars); start != input.npos;
+         start = input.find_first_not_of(whitespaceChars))
+    {
+        input.remove_prefix(start);
+        bingo.cells.push_back(ParseNumber<std::uint32_t>(input));
+        const auto end = input.find_first_of(whitespaceChars);
+        input.remove_prefix((end == input.npos) ? input.size() : end);
+    }
+    bingo.cells.resize(bingo.cells.size() - (bingo.cells.size() % (bingo.boardSize * bingo.boardSize)));
+    return bingo;
+}
+
+/// Simulates the draws. The marked state of every board line is a bitmask, so a board is a bingo if one of its line
+/// masks is full or if the AND of all its line masks is not zero.
+class BingoGame
+{
   public:
     explicit AOC_Y2021_CONSTEXPR BingoGame(std::string_view input)
+        : bingo(ParseBingoInput(input)), rowMarks(bingo.cells.size() / std::max<std::size_t>(1u, bingo.boardSize), 0u)
     {
-        const auto endOfFirstLine = input.find_first_of('\n');
-        if (endOfFirstLine == input.npos)
-        {
-            return;
-        }
-        auto firstLine = input.substr(0, endOfFirstLine);
-        input.remove_prefix(endOfFirstLine);
-        while (firstLine.size())
-        {
-            drawnNumbers.push_back(ParseNumber<std::uint8_t>(firstLine));
-            const auto delimiterPos = firstLine.find_first_of(',');
-            if (delimiterPos == firstLine.npos)
-            {
-                break;
-            }
-            firstLine.remove_prefix(delimiterPos + 1);
-        }
-        std::ranges::reverse(drawnNumbers);
-
-        constexpr auto whitespaceChars = "\t\r\n ";
-        while (input.size() > 5 && (input.find_first_not_of(whitespaceChars) != input.npos))
+        const auto numRows = rowMarks.size();
+        for (std::size_t board = 0; (board * bingo.boardSize) != numRows; ++board)
         {
-            auto &board = boards.emplace_back();
-            for (size_t row = 0; row != Board::numLines; ++row)
-            {
-                for (size_t col = 0; col != Board::numsPerLine; ++col)
-                {
-                    const auto start = input.find_first_not_of(whitespaceChars);
-                    if (start == input.npos)
-                    {
-                        input.remove_suffix(input.size());
-                        break;
-                    }
-                    input.remove_prefix(start);
-                    const auto num = ParseNumber<std::uint8_t>(input);
-                    board.aaNums[row][col].num = (num & 0b0111'1111);
-                    const auto end = input.find_first_of(whitespaceChars);
-                    if (end == input.npos)
-                    {
-                        input.remove_suffix(input.size());
-                        break;
-                    }
-                    input.remove_prefix(end);
-                }
-            }
+            boards.push_back(board);
         }
-        return;
     }
 
-    AOC_Y2021_CONSTEXPR std::optional<int64_t> DrawNextNumber()
+    AOC_Y2021_CONSTEXPR std::optional<BingoScore> DrawNextNumber()
     {
-        if (!drawnNumbers.size())
+        if (nextDraw == bingo.draws.size())
         {
             return std::nullopt;
         }
-        std::optional<int64_t> score = std::nullopt;
-        const auto drawn = drawnNumbers.back();
-        drawnNumbers.pop_back();
+        std::optional<BingoScore> score = std::nullopt;
+        const auto drawn = bingo.draws[nextDraw++];
         for (auto it = boards.begin(); it != boards.end();)
         {
-            const auto score_ = it->MarkNumber(drawn);
+            const auto score_ = MarkNumber(*it, drawn);
             bool bHasBingo = score_.has_value();
             if (bHasBingo)
             {
@@ -170,9 +133,9 @@ class BingoGame
         return score;
     }
 
-    AOC_Y2021_CONSTEXPR std::optional<int64_t> PlayPart1()
+    AOC_Y2021_CONSTEXPR std::optional<BingoScore> PlayPart1()
     {
-        while (boards.size() && drawnNumbers.size())
+        while (boards.size() && (nextDraw != bingo.draws.size()))
         {
             const auto score = DrawNextNumber();
             if (score.has_value())
@@ -183,10 +146,10 @@ class BingoGame
         return std::nullopt;
     }
 
-    AOC_Y2021_CONSTEXPR std::optional<int64_t> PlayPart2()
+    AOC_Y2021_CONSTEXPR std::optional<BingoScore> PlayPart2()
     {
-        std::optional<int64_t> score = std::nullopt;
-        while (boards.size() && drawnNumbers.size())
+        std::optional<BingoScore> score = std::nullopt;
+        while (boards.size() && (nextDraw != bingo.draws.size()))
         {
             const auto score_ = DrawNextNumber();
             if (score_.has_value())
@@ -198,10 +161,246 @@ class BingoGame
     }
 
   private:
-    std::vector<std::uint8_t> drawnNumbers;
-    std::vector<Board> boards;
+    AOC_Y2021_CONSTEXPR std::optional<BingoScore> MarkNumber(const std::size_t board, const std::uint32_t number)
+    {
+        const auto boardSize = bingo.boardSize;
+        const auto numCells = boardSize * boardSize;
+        const auto cells = std::span(bingo.cells).subspan(board * numCells, numCells);
+        const auto marks = std::span(rowMarks).subspan(board * boardSize, boardSize);
+        for (std::size_t cell = 0; cell != numCells; ++cell)
+        {
+            if (cells[cell] == number)
+            {
+                marks[cell / boardSize] |= std::uint64_t{1} << (cell % boardSize);
+            }
+        }
+        const auto fullLine = ~std::uint64_t{0} >> (BingoInput::maxBoardSize - boardSize);
+        bool bIsRowBingo = false;
+        auto markedColumns = fullLine;
+        for (const auto rowMark : marks)
+        {
+            bIsRowBingo = bIsRowBingo || (rowMark == fullLine);
+            markedColumns &= rowMark;
+        }
+        if (!bIsRowBingo && (markedColumns == 0u))
+        {
+            return std::nullopt;
+        }
+        std::uint64_t sumOfUnmarkedNums = 0u;
+        for (std::size_t cell = 0; cell != numCells; ++cell)
+        {
+            if (((marks[cell / boardSize] >> (cell % boardSize)) & 1u) == 0u)
+            {
+                sumOfUnmarkedNums += cells[cell];
+            }
+        }
+        return CalculateScore(sumOfUnmarkedNums, number);
+    }
+
+  private:
+    BingoInput bingo;
+    std::vector<std::uint64_t> rowMarks;
+    std::vector<std::size_t> boards;
+    std::size_t nextDraw{0};
 };
 
+constexpr auto notDrawn = std::numeric_limits<std::uint32_t>::max();
+
+/// Maps every board cell to the rank of the first draw of its number, or to notDrawn
+std::vector<std::uint32_t> RankCells(const BingoInput &bingo)
+{
+    using DrawRank = std::pair<std::uint32_t, std::uint32_t>;
+    std::vector<DrawRank> drawRanks;
+    for (std::uint32_t rank = 0; rank != bingo.draws.size(); ++rank)
+    {
+        drawRanks.emplace_back(bingo.draws[rank], rank);
+    }
+    std::ranges::stable_sort(drawRanks, {}, &DrawRank::first);
+    const auto duplicates = std::ranges::unique(drawRanks, {}, &DrawRank::first);
+    drawRanks.erase(duplicates.begin(), duplicates.end());
+
+    std::vector<std::uint32_t> cellRanks(bingo.cells.size(), notDrawn);
+    for (std::size_t cell = 0; cell != bingo.cells.size(); ++cell)
+    {
+        const auto it = std::ranges::lower_bound(drawRanks, bingo.cells[cell], {}, &DrawRank::first);
+        if ((it != drawRanks.end()) && (it->first == bingo.cells[cell]))
+        {
+            cellRanks[cell] = it->second;
+        }
+    }
+    return cellRanks;
+}
+
+/// Plays bingo through an inverted index from every draw to the cells holding its number. Each board keeps row and
+/// column hit counters and its running unmarked sum, so a draw only touches the cells it marks.
+BingoScores PlayIndexedBingo(const BingoInput &bingo)
+{
+    const auto cellRanks = RankCells(bingo);
+    std::vector<std::uint32_t> offsets(bingo.draws.size() + 1u, 0u);
+    for (const auto rank : cellRanks)
+    {
+        if (rank != notDrawn)
+        {
+            ++offsets[rank + 1u];
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<std::uint32_t> occurrences(offsets.back());
+    auto nextOccurrence = offsets;
+    for (std::size_t cell = 0; cell != bingo.cells.size(); ++cell)
+    {
+        if (cellRanks[cell] != notDrawn)
+        {
+            occurrences[nextOccurrence[cellRanks[cell]]++] = static_cast<std::uint32_t>(cell);
+        }
+    }
+
+    const auto boardSize = bingo.boardSize;
+    const auto boardCells = boardSize * boardSize;
+    const auto numBoards = (boardCells == 0u) ? 0u : (bingo.cells.size() / boardCells);
+    std::vector<std::uint8_t> rowHits(numBoards * boardSize, 0u);
+    std::vector<std::uint8_t> colHits(numBoards * boardSize, 0u);
+    std::vector<std::uint64_t> unmarkedSums(numBoards, 0u);
+    for (std::size_t cell = 0; cell != bingo.cells.size(); ++cell)
+    {
+        unmarkedSums[cell / boardCells] += bingo.cells[cell];
+    }
+    std::vector<std::uint32_t> winRanks(numBoards, notDrawn);
+    std::vector<std::size_t> winners;
+    std::size_t numWinners = 0u;
+    BingoScores scores;
+    for (std::uint32_t rank = 0; (rank != bingo.draws.size()) && (numWinners != numBoards); ++rank)
+    {
+        const auto number = bingo.draws[rank];
+        winners.clear();
+        for (auto occurrence = offsets[rank]; occurrence != offsets[rank + 1u]; ++occurrence)
+        {
+            const auto board = occurrences[occurrence] / boardCells;
+            if (winRanks[board] < rank)
+            {
+                continue;
+            }
+            const auto cell = occurrences[occurrence] % boardCells;
+            unmarkedSums[board] -= number;
+            const bool bRowComplete = (++rowHits[(board * boardSize) + (cell / boardSize)] == boardSize);
+            const bool bColComplete = (++colHits[(board * boardSize) + (cell % boardSize)] == boardSize);
+            if ((bRowComplete || bColComplete) && (winRanks[board] != rank))
+            {
+                winRanks[board] = rank;
+                winners.push_back(board);
+            }
+        }
+        if (!winners.empty())
+        {
+            numWinners += winners.size();
+            const auto score = CalculateScore(unmarkedSums[winners.front()], number);
+            if (!scores.first.has_value())
+            {
+                scores.first = score;
+            }
+            scores.last = score;
+        }
+    }
+    return scores;
+}
+
+/// Computes the winning turn of every board without simulating the draws: a line is complete at the highest draw rank
+/// of its cells, a board wins with its earliest complete line. The boards are evaluated in parallel blocks.
+BingoScores RankBingo(const BingoInput &bingo)
+{
+    struct BoardWin
+    {
+        std::uint32_t rank{notDrawn};
+        std::size_t board{0};
+    };
+    struct BlockWins
+    {
+        BoardWin first{};
+        BoardWin last{};
+    };
+    constexpr std::size_t boardsPerBlock = 4096u;
+    const auto cellRanks = RankCells(bingo);
+    const auto boardSize = bingo.boardSize;
+    const auto boardCells = boardSize * boardSize;
+    const auto numBoards = (boardCells == 0u) ? 0u : (bingo.cells.size() / boardCells);
+    const auto numBlocks = (numBoards + boardsPerBlock - 1u) / boardsPerBlock;
+    const auto fnWinRank = [&cellRanks, boardSize, boardCells](const std::size_t board) {
+        const auto ranks = std::span(cellRanks).subspan(board * boardCells, boardCells);
+        auto winRank = notDrawn;
+        for (std::size_t line = 0; line != boardSize; ++line)
+        {
+            std::uint32_t rowRank = 0u;
+            std::uint32_t colRank = 0u;
+            for (std::size_t i = 0; i != boardSize; ++i)
+            {
+                rowRank = std::max(rowRank, ranks[(line * boardSize) + i]);
+                colRank = std::max(colRank, ranks[(i * boardSize) + line]);
+            }
+            winRank = std::min({winRank, rowRank, colRank});
+        }
+        return winRank;
+    };
+    // ties go to the lower board index, as in the simulation
+    const auto fnMerge = [](BlockWins &wins, const BoardWin &win) {
+        if ((win.rank != notDrawn) && ((wins.first.rank == notDrawn) || (win.rank < wins.first.rank)))
+        {
+            wins.first = win;
+        }
+        if ((win.rank != notDrawn) && ((wins.last.rank == notDrawn) || (win.rank > wins.last.rank)))
+        {
+            wins.last = win;
+        }
+    };
+    std::vector<BlockWins> blockWins(numBlocks);
+    ParallelFor(numBlocks, [&](const std::size_t block) {
+        const auto endBoard = std::min(numBoards, (block + 1u) * boardsPerBlock);
+        for (auto board = block * boardsPerBlock; board != endBoard; ++board)
+        {
+            fnMerge(blockWins[block], BoardWin{fnWinRank(board), board});
+        }
+    });
+    BlockWins wins{};
+    for (const auto &block : blockWins)
+    {
+        fnMerge(wins, block.first);
+        fnMerge(wins, block.last);
+    }
+    const auto fnScore = [&](const BoardWin &win) -> std::optional<BingoScore> {
+        if (win.rank == notDrawn)
+        {
+            return std::nullopt;
+        }
+        std::uint64_t sumOfUnmarkedNums = 0u;
+        for (auto cell = win.board * boardCells; cell != (win.board + 1u) * boardCells; ++cell)
+        {
+            sumOfUnmarkedNums += (cellRanks[cell] > win.rank) ? bingo.cells[cell] : 0u;
+        }
+        return CalculateScore(sumOfUnmarkedNums, bingo.draws[win.rank]);
+    };
+    return {fnScore(wins.first), fnScore(wins.last)};
+}
+
+/// the score as std::int64_t if it fits, otherwise as decimal string
+IPuzzle::Solution_t ToSolution(const std::optional<BingoScore> &score)
+{
+    if (!score.has_value())
+    {
+        return std::monostate{};
+    }
+    constexpr auto maxInt64 = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    const auto score64 = score->GetUInt64();
+    if (score64.has_value() && (score64.value() <= maxInt64))
+    {
+        return static_cast<std::int64_t>(score64.value());
+    }
+    const auto decimal = score->Get();
+    if (!decimal.has_value())
+    {
+        return std::monostate{};
+    }
+    return decimal.value();
+}
+
 } // namespace
 
 class PuzzleDay04Impl final
@@ -217,6 +416,21 @@ class PuzzleDay04Impl final
 };
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(04)
 
+namespace
+{
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay04Impl &impl)
+{
+    return ToSolution(impl.game.PlayPart1());
+}
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay04Impl &impl)
+{
+    return ToSolution(impl.game.PlayPart2());
+}
+
+} // namespace
+
 PuzzleDay04::PuzzleDay04(const std::string_view input) : pImpl(std::make_unique<PuzzleDay04Impl>(input))
 {
 }
@@ -225,30 +439,80 @@ PuzzleDay04::~PuzzleDay04() = default;
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay04::Part1()
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    const auto result = pImpl->game.PlayPart1();
-    if (result.has_value())
-    {
-        return result.value();
-    }
-    return std::monostate{};
+    return SolvePart1(*pImpl);
 }
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay04::Part2()
 {
-    if (!pImpl)
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<4>(const std::string_view input)
+{
+    PuzzleDay04Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+class PuzzleDay04OptimizedImpl final
+{
+
+  public:
+    explicit PuzzleDay04OptimizedImpl(std::string_view input) : scores(PlayIndexedBingo(ParseBingoInput(input)))
     {
-        return std::monostate{};
     }
-    const auto result = pImpl->game.PlayPart2();
-    if (result.has_value())
+
+  public:
+    BingoScores scores;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(04, Optimized)
+
+PuzzleDay04Optimized::PuzzleDay04Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay04OptimizedImpl>(input))
+{
+}
+
+PuzzleDay04Optimized::~PuzzleDay04Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay04Optimized::Part1()
+{
+    return ToSolution(pImpl->scores.first);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay04Optimized::Part2()
+{
+    return ToSolution(pImpl->scores.last);
+}
+
+class PuzzleDay04ParallelImpl final
+{
+
+  public:
+    explicit PuzzleDay04ParallelImpl(std::string_view input) : scores(RankBingo(ParseBingoInput(input)))
     {
-        return result.value();
     }
-    return std::monostate{};
+
+  public:
+    BingoScores scores;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(04, Parallel)
+
+PuzzleDay04Parallel::PuzzleDay04Parallel(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay04ParallelImpl>(input))
+{
+}
+
+PuzzleDay04Parallel::~PuzzleDay04Parallel() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay04Parallel::Part1()
+{
+    return ToSolution(pImpl->scores.first);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay04Parallel::Part2()
+{
+    return ToSolution(pImpl->scores.last);
 }
 
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
@@ -264,9 +528,11 @@ namespace
         "5\r\n 2  0 12  3  7\r";
 
     static_assert(BingoGame(exampleInput).PlayPart1().has_value(), "Day 4 Part 1 failed to calculate a score");
-    static_assert(BingoGame(exampleInput).PlayPart1().value() == 4512, "Day 4 Part 1 failed: wrong score");
+    static_assert(BingoGame(exampleInput).PlayPart1().value().GetUInt64() == 4512u,
+                  "Day 4 Part 1 failed: wrong score");
     static_assert(BingoGame(exampleInput).PlayPart2().has_value(), "Day 4 Part 2 failed to calculate a score");
-    static_assert(BingoGame(exampleInput).PlayPart2().value() == 1924, "Day 4 Part 2 failed: wrong score");
+    static_assert(BingoGame(exampleInput).PlayPart2().value().GetUInt64() == 1924u,
+                  "Day 4 Part 2 failed: wrong score");
 }
 
 } // namespace
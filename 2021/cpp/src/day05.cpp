@@ -1,11 +1,20 @@
 #include "ipuzzle.hpp"
+#include "parallel_utils.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <ranges>
 #include <string_view>
 #include <utility>
@@ -40,101 +49,130 @@ class OceanFloor final
         Coordinate endCoord{};
     };
 
+    /// Lines as structure of arrays, together with the bounding box of all their coordinates
+    class Lines final
+    {
+      public:
+        [[nodiscard]] AOC_Y2021_CONSTEXPR std::size_t size() const
+        {
+            return startX.size();
+        }
+
+        [[nodiscard]] AOC_Y2021_CONSTEXPR bool empty() const
+        {
+            return startX.empty();
+        }
+
+        [[nodiscard]] AOC_Y2021_CONSTEXPR Line operator[](const std::size_t index) const
+        {
+            return Line{{startX[index], startY[index]}, {endX[index], endY[index]}};
+        }
+
+        AOC_Y2021_CONSTEXPR void reserve(const std::size_t numLines)
+        {
+            for (auto *coordinates : {&startX, &startY, &endX, &endY})
+            {
+                coordinates->reserve(numLines);
+            }
+        }
+
+        AOC_Y2021_CONSTEXPR void push_back(const Line &line)
+        {
+            startX.push_back(line.startCoord.first);
+            startY.push_back(line.startCoord.second);
+            endX.push_back(line.endCoord.first);
+            endY.push_back(line.endCoord.second);
+            minCoord.first = std::min({minCoord.first, line.startCoord.first, line.endCoord.first});
+            minCoord.second = std::min({minCoord.second, line.startCoord.second, line.endCoord.second});
+            maxCoord.first = std::max({maxCoord.first, line.startCoord.first, line.endCoord.first});
+            maxCoord.second = std::max({maxCoord.second, line.startCoord.second, line.endCoord.second});
+        }
+
+      public:
+        std::vector<std::uint32_t> startX;
+        std::vector<std::uint32_t> startY;
+        std::vector<std::uint32_t> endX;
+        std::vector<std::uint32_t> endY;
+        Line::Coordinate minCoord{std::numeric_limits<std::uint32_t>::max(), std::numeric_limits<std::uint32_t>::max()};
+        Line::Coordinate maxCoord{0u, 0u};
+    };
+
   public:
-    AOC_Y2021_CONSTEXPR static std::vector<Line> ParseInput(std::string_view input)
+    /// Parses the "x1,y1 -> x2,y2" lines in a single pass, stopping at the first empty line. Returns no lines if a line
+    /// is malformed.
+    AOC_Y2021_CONSTEXPR static Lines ParseInput(const std::string_view input)
     {
-        std::vector<Line> ret;
-        while (input.size())
+        Lines lines;
+        constexpr std::size_t minLineLength = std::string_view{"0,0 -> 0,0\n"}.size();
+        lines.reserve((input.size() / minLineLength) + 1u);
+        std::size_t pos = 0u;
+        const auto fnSkipBlanks = [&input, &pos]() {
+            while ((pos < input.size()) && (input[pos] == ' '))
+            {
+                ++pos;
+            }
+        };
+        const auto fnSkipToken = [&input, &pos, &fnSkipBlanks](const std::string_view token) {
+            fnSkipBlanks();
+            if (input.substr(pos, token.size()) != token)
+            {
+                return false;
+            }
+            pos += token.size();
+            fnSkipBlanks();
+            return true;
+        };
+        const auto fnParseNumber = [&input, &pos](std::uint32_t &number) {
+            const auto start = pos;
+            number = 0u;
+            for (; (pos < input.size()) && (input[pos] >= '0') && (input[pos] <= '9'); ++pos)
+            {
+                number = (number * 10u) + static_cast<std::uint32_t>(input[pos] - '0');
+            }
+            return pos != start;
+        };
+        for (fnSkipBlanks(); (pos < input.size()) && (input[pos] != '\r') && (input[pos] != '\n'); fnSkipBlanks())
         {
-            constexpr std::string_view arrow{"->"};
-            const auto arrowPos = input.find(arrow);
-            const auto endOfLine = input.find('\n');
-            if ((arrowPos == input.npos) || (arrowPos >= endOfLine) || (arrowPos >= input.size()))
+            Line line{};
+            if (!fnParseNumber(line.startCoord.first) || !fnSkipToken(",") || !fnParseNumber(line.startCoord.second) ||
+                !fnSkipToken("->") || !fnParseNumber(line.endCoord.first) || !fnSkipToken(",") ||
+                !fnParseNumber(line.endCoord.second))
             {
                 return {};
             }
-            const auto arrowStr = input.substr(arrowPos);
-            if (arrowStr.size() <= arrow.size())
+            lines.push_back(line);
+            fnSkipBlanks();
+            if ((pos < input.size()) && (input[pos] == '\r'))
             {
-                return {};
+                ++pos;
             }
-            const std::array<std::string_view, 2u> aPointStrs = {input.substr(0u, arrowPos),
-                                                                 input.substr(arrowPos + arrow.size())};
-            bool bFirst = true;
-            decltype(Line::Coordinate::first) x1 = 0, x2 = 0;
-            decltype(Line::Coordinate::second) y1 = 0, y2 = 0;
-            for (const auto &str : aPointStrs)
+            if (pos < input.size())
             {
-                const auto delimiterPos = str.find(',');
-                if (delimiterPos == str.npos)
-                {
-                    return {};
-                }
-                const auto xStr = str.substr(0, delimiterPos);
-                const auto yStr = str.substr(delimiterPos + 1);
-                if ((xStr.size() == 0) || (yStr.size() == 0))
+                if (input[pos] != '\n')
                 {
                     return {};
                 }
-                if (bFirst)
-                {
-                    x1 = ParseNumber<std::uint32_t>(xStr);
-                    y1 = ParseNumber<std::uint32_t>(yStr);
-                    bFirst = false;
-                }
-                else
-                {
-                    x2 = ParseNumber<std::uint32_t>(xStr);
-                    y2 = ParseNumber<std::uint32_t>(yStr);
-                }
-            }
-            ret.push_back(Line{{x1, y1}, {x2, y2}});
-
-            if (endOfLine == input.npos)
-            {
-                break;
-            }
-            else
-            {
-                input.remove_prefix(endOfLine + 1);
+                ++pos;
             }
         }
-        return ret;
+        return lines;
     }
 
-    AOC_Y2021_CONSTEXPR static auto GetGridDimensions(const auto &gridLines)
+    /// The grid spans the bounding box of the lines, its origin is their minimum coordinate
+    AOC_Y2021_CONSTEXPR static std::int64_t CalculateOverlappingPoints(const Lines &lines,
+                                                                       const bool bOnlyHorizontalOrVerticalLines = true)
     {
-        if (gridLines.empty())
+        if (lines.empty())
         {
-            return std::pair<decltype(Line::Coordinate::first), decltype(Line::Coordinate::second)>{};
+            return 0;
         }
-        const auto startPointXMax =
-            std::max_element(gridLines.begin(), gridLines.end(), [](const auto &lhs, const auto &rhs) {
-                return lhs.startCoord.first < rhs.startCoord.first;
-            })->startCoord.first;
-        const auto startPointYMax =
-            std::max_element(gridLines.begin(), gridLines.end(), [](const auto &lhs, const auto &rhs) {
-                return lhs.startCoord.second < rhs.startCoord.second;
-            })->startCoord.second;
-        const auto endPointXMax =
-            std::max_element(gridLines.begin(), gridLines.end(), [](const auto &lhs, const auto &rhs) {
-                return lhs.endCoord.first < rhs.endCoord.first;
-            })->endCoord.first;
-        const auto endPointYMax =
-            std::max_element(gridLines.begin(), gridLines.end(), [](const auto &lhs, const auto &rhs) {
-                return lhs.endCoord.second < rhs.endCoord.second;
-            })->endCoord.second;
-
-        return std::make_pair(std::max(startPointXMax, endPointXMax) + 1, std::max(startPointYMax, endPointYMax) + 1);
-    }
-
-    AOC_Y2021_CONSTEXPR static std::int64_t CalculateOverlappingPoints(const auto &lines,
-                                                                       const bool bOnlyHorizontalOrVerticalLines = true)
-    {
-        const auto gridDimensions = GetGridDimensions(lines);
-        std::vector<uint8_t> grid(gridDimensions.first * gridDimensions.second);
-        for (const auto &line : lines)
+        const auto [minX, minY] = lines.minCoord;
+        const std::size_t width = std::size_t{lines.maxCoord.first} - minX + 1u;
+        const std::size_t height = std::size_t{lines.maxCoord.second} - minY + 1u;
+        std::vector<uint8_t> grid(width * height);
+        for (std::size_t index = 0; index != lines.size(); ++index)
         {
+            const auto line = lines[index];
             if (bOnlyHorizontalOrVerticalLines)
             {
                 if (!line.IsVertical() && !line.IsHorizontal())
@@ -142,8 +180,8 @@ class OceanFloor final
                     continue;
                 }
             }
-            const auto fnFlattenCoordinate = [gridDimensions](const Line::Coordinate &co) -> std::size_t {
-                return std::size_t{(gridDimensions.first * co.second) + co.first};
+            const auto fnFlattenCoordinate = [width, minX, minY](const Line::Coordinate &co) -> std::size_t {
+                return (width * (co.second - minY)) + (co.first - minX);
             };
             const size_t startCoordFlat{fnFlattenCoordinate(line.startCoord)};
             const size_t endCoordFlat{fnFlattenCoordinate(line.endCoord)};
@@ -154,21 +192,21 @@ class OceanFloor final
             {
                 return -__LINE__;
             }
-            const auto advance = [&line, &bSwap, &gridDimensions]() -> std::size_t {
+            const auto advance = [&line, &bSwap, width]() -> std::size_t {
                 if (line.IsHorizontal())
                 {
                     return 1;
                 }
                 else if (line.IsVertical())
                 {
-                    return gridDimensions.first;
+                    return width;
                 }
                 else
                 {
                     const auto &startCo = bSwap ? line.endCoord : line.startCoord;
                     const auto &endCo = bSwap ? line.startCoord : line.endCoord;
                     const bool bGoDownLeft = (startCo.first > endCo.first);
-                    return bGoDownLeft ? (gridDimensions.first - 1) : (gridDimensions.first + 1);
+                    return bGoDownLeft ? (width - 1) : (width + 1);
                 }
             }();
 
@@ -185,6 +223,558 @@ class OceanFloor final
     OceanFloor(OceanFloor &&) = delete;
 };
 
+/// Every line lies on one of the line families a * x + b * y = key. Along a line, a point is identified by the
+/// parameter t, which is y for vertical lines and x otherwise.
+enum LineFamily : std::size_t
+{
+    LINE_FAMILY_HORIZONTAL,
+    LINE_FAMILY_VERTICAL,
+    LINE_FAMILY_DIAGONAL,
+    LINE_FAMILY_ANTI_DIAGONAL,
+    LINE_FAMILY_COUNT,
+};
+
+/// coefficients (a, b) of each line family
+constexpr std::array<std::array<std::int64_t, 2u>, LINE_FAMILY_COUNT> lineFamilyCoefficients{{
+    {0, 1},
+    {1, 0},
+    {1, -1},
+    {1, 1},
+}};
+
+struct Segment
+{
+    std::int64_t key;
+    std::int64_t lo;
+    std::int64_t hi;
+    constexpr auto operator<=>(const Segment &) const = default;
+};
+
+using Point = std::pair<std::int64_t, std::int64_t>;
+
+constexpr std::int64_t LineKey(const std::size_t family, const Point &point)
+{
+    return (lineFamilyCoefficients[family][0] * point.first) + (lineFamilyCoefficients[family][1] * point.second);
+}
+
+constexpr std::int64_t LineParameter(const std::size_t family, const Point &point)
+{
+    return (family == LINE_FAMILY_VERTICAL) ? point.second : point.first;
+}
+
+constexpr Point PointOnLine(const std::size_t family, const std::int64_t key, const std::int64_t t)
+{
+    switch (family)
+    {
+    case LINE_FAMILY_HORIZONTAL:
+        return {t, key};
+    case LINE_FAMILY_VERTICAL:
+        return {key, t};
+    case LINE_FAMILY_DIAGONAL:
+        return {t, t - key};
+    default:
+        return {t, key - t};
+    }
+}
+
+/// The segments of one line family merged per key: the disjoint intervals covered by at least one and by at least two
+/// segments, both sorted by key and start
+struct FamilyCoverage
+{
+    std::vector<Segment> covered;
+    std::vector<Segment> overlapped;
+};
+
+/// Merges the sorted segments of one line family. Touching intervals are joined, as they cover consecutive points.
+FamilyCoverage MergeCollinearSegments(const std::vector<Segment> &segments)
+{
+    FamilyCoverage coverage;
+    auto &covered = coverage.covered;
+    auto &overlapped = coverage.overlapped;
+    for (const auto &segment : segments)
+    {
+        if (covered.empty() || (covered.back().key != segment.key) || (segment.lo > (covered.back().hi + 1)))
+        {
+            covered.push_back(segment);
+            continue;
+        }
+        const auto overlapHi = std::min(segment.hi, covered.back().hi);
+        if (segment.lo <= overlapHi)
+        {
+            if (!overlapped.empty() && (overlapped.back().key == segment.key) &&
+                (segment.lo <= (overlapped.back().hi + 1)))
+            {
+                overlapped.back().hi = std::max(overlapped.back().hi, overlapHi);
+            }
+            else
+            {
+                overlapped.push_back({segment.key, segment.lo, overlapHi});
+            }
+        }
+        covered.back().hi = std::max(covered.back().hi, segment.hi);
+    }
+    return coverage;
+}
+
+/// Set of the indices below a bound as a tree of 64 bit masks, where a bit of an upper level marks a non-empty mask
+/// below it. Inserting, erasing and finding the next element take O(log n) with a logarithm of base 64.
+class IndexSet final
+{
+  public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    explicit IndexSet(std::size_t bound)
+    {
+        do
+        {
+            bound = (bound + 63u) / 64u;
+            levels.emplace_back(bound, 0u);
+        } while (bound > 1u);
+    }
+
+    void Insert(std::size_t index)
+    {
+        for (auto &level : levels)
+        {
+            auto &mask = level[index / 64u];
+            const bool bWasEmpty = (mask == 0u);
+            mask |= Bit(index);
+            if (!bWasEmpty)
+            {
+                return;
+            }
+            index /= 64u;
+        }
+    }
+
+    void Erase(std::size_t index)
+    {
+        for (auto &level : levels)
+        {
+            auto &mask = level[index / 64u];
+            mask &= ~Bit(index);
+            if (mask != 0u)
+            {
+                return;
+            }
+            index /= 64u;
+        }
+    }
+
+    /// smallest element not below index, npos if there is none
+    [[nodiscard]] std::size_t Next(std::size_t index) const
+    {
+        std::size_t depth = 0;
+        for (;; ++depth)
+        {
+            if ((depth == levels.size()) || ((index / 64u) >= levels[depth].size()))
+            {
+                return npos;
+            }
+            const auto mask = levels[depth][index / 64u] & (~std::uint64_t{0} << (index % 64u));
+            if (mask != 0u)
+            {
+                index = ((index / 64u) * 64u) + static_cast<std::size_t>(std::countr_zero(mask));
+                break;
+            }
+            index = (index / 64u) + 1u;
+        }
+        for (; depth != 0u; --depth)
+        {
+            index = (index * 64u) + static_cast<std::size_t>(std::countr_zero(levels[depth - 1u][index]));
+        }
+        return index;
+    }
+
+  private:
+    static constexpr std::uint64_t Bit(const std::size_t index)
+    {
+        return std::uint64_t{1} << (index % 64u);
+    }
+
+    std::vector<std::vector<std::uint64_t>> levels;
+};
+
+/// Crossings of the lines of a family with the intervals of another family. In the coordinates
+/// (u, v) = (key of family, key of otherFamily), the lines of family are vertical and the intervals of otherFamily are
+/// horizontal segments. Sweeping the lines in ascending u, the intervals spanning u are kept in an IndexSet over their
+/// v, so that a query visits only the intervals it crosses, in ascending parameter t along the line. Diagonal and
+/// anti-diagonal keys of a common point have the same parity, which is part of the sweep key so that no crossing
+/// between two integer points is visited.
+class CrossingSweep final
+{
+  public:
+    static constexpr std::int64_t npos = std::numeric_limits<std::int64_t>::max();
+
+    CrossingSweep(const std::size_t family, const std::size_t otherFamily, const std::vector<Segment> &otherIntervals,
+                  const bool bOverlapped)
+        : family(family), otherFamily(otherFamily), bOverlapped(bOverlapped), active(otherIntervals.size())
+    {
+        const auto [a, b] = lineFamilyCoefficients[family];
+        const auto [otherA, otherB] = lineFamilyCoefficients[otherFamily];
+        const auto determinant = (a * otherB) - (otherA * b);
+        parityMask = (std::abs(determinant) == 2) ? 1 : 0;
+        determinantSign = (determinant < 0) ? -1 : 1;
+        // sort the keys of otherFamily by the parameter t of their crossing with a line of family
+        const auto slope = (family == LINE_FAMILY_VERTICAL) ? a : -b;
+        direction = ((slope < 0) == (determinant < 0)) ? 1 : -1;
+
+        sweepKeys.reserve(otherIntervals.size());
+        for (const auto &interval : otherIntervals)
+        {
+            sweepKeys.push_back(SweepKeyOf(interval.key));
+        }
+        std::ranges::sort(sweepKeys);
+        const auto duplicates = std::ranges::unique(sweepKeys);
+        sweepKeys.erase(duplicates.begin(), duplicates.end());
+
+        events.reserve(2u * otherIntervals.size());
+        for (const auto &interval : otherIntervals)
+        {
+            const auto keyIndex = IndexOf(SweepKeyOf(interval.key));
+            const auto uAtLo = LineKey(family, PointOnLine(otherFamily, interval.key, interval.lo));
+            const auto uAtHi = LineKey(family, PointOnLine(otherFamily, interval.key, interval.hi));
+            events.push_back({std::min(uAtLo, uAtHi), false, keyIndex});
+            events.push_back({std::max(uAtLo, uAtHi), true, keyIndex});
+        }
+        std::ranges::sort(events, [](const Event &lhs, const Event &rhs) {
+            return (lhs.u < rhs.u) || ((lhs.u == rhs.u) && (lhs.bRemove < rhs.bRemove));
+        });
+    }
+
+    [[nodiscard]] bool IsOverlapped() const
+    {
+        return bOverlapped;
+    }
+
+    /// starts the crossings of a query interval of family. The queries must come in ascending key.
+    void Begin(const Segment &query)
+    {
+        u = query.key;
+        for (; (nextEvent != events.size()) &&
+               ((events[nextEvent].u < u) || ((events[nextEvent].u == u) && !events[nextEvent].bRemove));
+             ++nextEvent)
+        {
+            if (events[nextEvent].bRemove)
+            {
+                active.Erase(events[nextEvent].keyIndex);
+            }
+            else
+            {
+                active.Insert(events[nextEvent].keyIndex);
+            }
+        }
+        const auto vAtLo = LineKey(otherFamily, PointOnLine(family, u, query.lo));
+        const auto vAtHi = LineKey(otherFamily, PointOnLine(family, u, query.hi));
+        end = IndexOf({u & parityMask, std::max(direction * vAtLo, direction * vAtHi) + 1});
+        Seek(IndexOf({u & parityMask, std::min(direction * vAtLo, direction * vAtHi)}));
+    }
+
+    /// parameter t of the current crossing along the query, npos once all crossings were visited
+    [[nodiscard]] std::int64_t Parameter() const
+    {
+        return t;
+    }
+
+    void Advance()
+    {
+        Seek(current + 1u);
+    }
+
+  private:
+    using SweepKey = std::pair<std::int64_t, std::int64_t>; // (parity, key in ascending t)
+
+    struct Event
+    {
+        std::int64_t u;
+        bool bRemove;
+        std::size_t keyIndex;
+    };
+
+    [[nodiscard]] SweepKey SweepKeyOf(const std::int64_t v) const
+    {
+        return {v & parityMask, direction * v};
+    }
+
+    [[nodiscard]] std::size_t IndexOf(const SweepKey &key) const
+    {
+        return static_cast<std::size_t>(std::ranges::lower_bound(sweepKeys, key) - sweepKeys.begin());
+    }
+
+    void Seek(const std::size_t index)
+    {
+        current = active.Next(index);
+        if (current >= end)
+        {
+            t = npos;
+            return;
+        }
+        // the determinant is +-1 or +-2 and the numerators of a crossing are multiples of it, so no division is needed
+        const auto v = direction * sweepKeys[current].second;
+        const auto [a, b] = lineFamilyCoefficients[family];
+        const auto [otherA, otherB] = lineFamilyCoefficients[otherFamily];
+        const auto numerator = (family == LINE_FAMILY_VERTICAL) ? ((a * v) - (otherA * u)) : ((u * otherB) - (v * b));
+        t = (determinantSign * numerator) >> parityMask;
+    }
+
+    std::size_t family;
+    std::size_t otherFamily;
+    bool bOverlapped;
+    std::int64_t parityMask{};
+    std::int64_t determinantSign{};
+    std::int64_t direction{};
+    std::vector<SweepKey> sweepKeys;
+    std::vector<Event> events;
+    std::size_t nextEvent = 0;
+    IndexSet active;
+    std::int64_t u = 0;
+    std::size_t current = 0;
+    std::size_t end = 0;
+    std::int64_t t = npos;
+};
+
+/// Counts the points covered by at least two lines without a grid. Collinear segments are merged per line family into
+/// disjoint intervals, then each family is swept against the higher families. This takes O((n + k) log n) for n
+/// segments and k crossings, and memory is proportional to the number of segments, not to the coordinate range.
+std::optional<std::int64_t> CountOverlappingPointsSparse(const OceanFloor::Lines &lines,
+                                                         const bool bOnlyHorizontalOrVerticalLines)
+{
+    std::array<std::vector<Segment>, LINE_FAMILY_COUNT> familySegments;
+    for (std::size_t index = 0; index != lines.size(); ++index)
+    {
+        const auto line = lines[index];
+        const Point start{line.startCoord.first, line.startCoord.second};
+        const Point end{line.endCoord.first, line.endCoord.second};
+        const auto dx = end.first - start.first;
+        const auto dy = end.second - start.second;
+        std::size_t family = LINE_FAMILY_COUNT;
+        if (dy == 0)
+        {
+            family = LINE_FAMILY_HORIZONTAL;
+        }
+        else if (dx == 0)
+        {
+            family = LINE_FAMILY_VERTICAL;
+        }
+        else if (bOnlyHorizontalOrVerticalLines)
+        {
+            continue;
+        }
+        else if (dx == dy)
+        {
+            family = LINE_FAMILY_DIAGONAL;
+        }
+        else if (dx == -dy)
+        {
+            family = LINE_FAMILY_ANTI_DIAGONAL;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+        const auto startT = LineParameter(family, start);
+        const auto endT = LineParameter(family, end);
+        familySegments[family].push_back({LineKey(family, start), std::min(startT, endT), std::max(startT, endT)});
+    }
+
+    std::int64_t numOverlappingPoints = 0;
+    std::array<FamilyCoverage, LINE_FAMILY_COUNT> coverage;
+    for (std::size_t family = 0; family != LINE_FAMILY_COUNT; ++family)
+    {
+        std::ranges::sort(familySegments[family]);
+        coverage[family] = MergeCollinearSegments(familySegments[family]);
+        familySegments[family] = {};
+        for (const auto &overlap : coverage[family].overlapped)
+        {
+            numOverlappingPoints += overlap.hi - overlap.lo + 1;
+        }
+    }
+
+    // A point covered by m families is visited while sweeping along the lowest m - 1 of them and counted along the
+    // second highest, where a single higher family meets it. Each collinear overlap containing it counted it already.
+    for (std::size_t family = 0; family != LINE_FAMILY_COUNT; ++family)
+    {
+        std::vector<CrossingSweep> sweeps;
+        for (auto otherFamily = family + 1u; otherFamily != LINE_FAMILY_COUNT; ++otherFamily)
+        {
+            if (!coverage[otherFamily].covered.empty())
+            {
+                sweeps.emplace_back(family, otherFamily, coverage[otherFamily].covered, false);
+            }
+            if (!coverage[otherFamily].overlapped.empty())
+            {
+                sweeps.emplace_back(family, otherFamily, coverage[otherFamily].overlapped, true);
+            }
+        }
+        if (sweeps.empty())
+        {
+            continue;
+        }
+
+        auto overlap = coverage[family].overlapped.cbegin();
+        std::vector<CrossingSweep *> crossing;
+        crossing.reserve(sweeps.size());
+        for (const auto &query : coverage[family].covered)
+        {
+            crossing.clear();
+            for (auto &sweep : sweeps)
+            {
+                sweep.Begin(query);
+                if (sweep.Parameter() != CrossingSweep::npos)
+                {
+                    crossing.push_back(&sweep);
+                }
+            }
+            while (!crossing.empty())
+            {
+                const auto t = (*std::ranges::min_element(crossing, {}, &CrossingSweep::Parameter))->Parameter();
+                std::int64_t numHigherFamilies = 0;
+                std::int64_t numHigherOverlaps = 0;
+                for (std::size_t index = 0; index != crossing.size();)
+                {
+                    auto &sweep = *crossing[index];
+                    if (sweep.Parameter() != t)
+                    {
+                        ++index;
+                        continue;
+                    }
+                    numHigherFamilies += sweep.IsOverlapped() ? 0 : 1;
+                    numHigherOverlaps += sweep.IsOverlapped() ? 1 : 0;
+                    sweep.Advance();
+                    if (sweep.Parameter() == CrossingSweep::npos)
+                    {
+                        crossing[index] = crossing.back();
+                        crossing.pop_back();
+                    }
+                    else
+                    {
+                        ++index;
+                    }
+                }
+                while ((overlap != coverage[family].overlapped.cend()) &&
+                       ((overlap->key < query.key) || ((overlap->key == query.key) && (overlap->hi < t))))
+                {
+                    ++overlap;
+                }
+                if ((overlap != coverage[family].overlapped.cend()) && (overlap->key == query.key) &&
+                    (overlap->lo <= t))
+                {
+                    --numOverlappingPoints;
+                }
+                if (numHigherFamilies == 1)
+                {
+                    numOverlappingPoints += 1 - numHigherOverlaps;
+                }
+            }
+        }
+    }
+    return numOverlappingPoints;
+}
+
+/// Rasterizes the lines in bands of rows, each task owns the counters of one band. Every cell has a 2 bit saturating
+/// counter kept in two bit planes: the first line over a cell sets its covered bit, any further line its overlapped
+/// bit. The overlapping points of a band are the popcount of its overlapped plane.
+std::optional<std::int64_t> CountOverlappingPointsTiled(const OceanFloor::Lines &lines,
+                                                        const bool bOnlyHorizontalOrVerticalLines)
+{
+    struct Raster
+    {
+        std::int64_t x;
+        std::int64_t y;
+        std::int64_t dx;
+        std::int64_t dy;
+        std::int64_t length;
+    };
+    std::vector<Raster> rasters;
+    const auto [minX, minY] = lines.minCoord;
+    for (std::size_t index = 0; index != lines.size(); ++index)
+    {
+        const auto line = lines[index];
+        const auto x = static_cast<std::int64_t>(line.startCoord.first) - minX;
+        const auto y = static_cast<std::int64_t>(line.startCoord.second) - minY;
+        const auto distX = static_cast<std::int64_t>(line.endCoord.first) - minX - x;
+        const auto distY = static_cast<std::int64_t>(line.endCoord.second) - minY - y;
+        const bool bIsDiagonal = (distX != 0) && (distY != 0);
+        if (bIsDiagonal && bOnlyHorizontalOrVerticalLines)
+        {
+            continue;
+        }
+        if (bIsDiagonal && (std::abs(distX) != std::abs(distY)))
+        {
+            return std::nullopt;
+        }
+        rasters.push_back({x, y, (distX > 0) - (distX < 0), (distY > 0) - (distY < 0),
+                           std::max(std::abs(distX), std::abs(distY))});
+    }
+    if (rasters.empty())
+    {
+        return 0;
+    }
+
+    constexpr std::size_t rowsPerBand = 64u;
+    const std::size_t width = std::size_t{lines.maxCoord.first} - minX + 1u;
+    const auto height = static_cast<std::int64_t>(lines.maxCoord.second) - minY + 1;
+    const std::size_t wordsPerRow = (width + 63u) / 64u;
+    const std::size_t numBands = (static_cast<std::size_t>(height) + rowsPerBand - 1u) / rowsPerBand;
+    std::vector<std::vector<std::uint32_t>> bandRasters(numBands);
+    for (std::uint32_t index = 0; index != rasters.size(); ++index)
+    {
+        const auto &raster = rasters[index];
+        const auto endY = raster.y + (raster.dy * raster.length);
+        for (auto band = static_cast<std::size_t>(std::min(raster.y, endY)) / rowsPerBand;
+             band <= (static_cast<std::size_t>(std::max(raster.y, endY)) / rowsPerBand); ++band)
+        {
+            bandRasters[band].push_back(index);
+        }
+    }
+
+    std::vector<std::int64_t> bandCounts(numBands, 0);
+    ParallelFor(numBands, [&](const std::size_t band) {
+        const auto bandY = static_cast<std::int64_t>(band * rowsPerBand);
+        const auto bandRows = std::min<std::int64_t>(rowsPerBand, height - bandY);
+        std::vector<std::uint64_t> covered(static_cast<std::size_t>(bandRows) * wordsPerRow, 0u);
+        std::vector<std::uint64_t> overlapped(covered.size(), 0u);
+        const auto fnMark = [&](const std::size_t word, const std::uint64_t bits) {
+            overlapped[word] |= covered[word] & bits;
+            covered[word] |= bits;
+        };
+        for (const auto index : bandRasters[band])
+        {
+            const auto &raster = rasters[index];
+            if (raster.dy == 0)
+            {
+                // horizontal lines are marked a word at a time
+                const auto rowWord = static_cast<std::size_t>(raster.y - bandY) * wordsPerRow;
+                const auto xLo = static_cast<std::size_t>(std::min(raster.x, raster.x + (raster.dx * raster.length)));
+                const auto xHi = static_cast<std::size_t>(std::max(raster.x, raster.x + (raster.dx * raster.length)));
+                for (auto x = xLo; x <= xHi; x = (x & ~std::size_t{63u}) + 64u)
+                {
+                    const auto lastBit = std::min<std::size_t>(63u, xHi - (x & ~std::size_t{63u}));
+                    const auto bits = (~std::uint64_t{0} >> (63u - lastBit)) & (~std::uint64_t{0} << (x % 64u));
+                    fnMark(rowWord + (x / 64u), bits);
+                }
+                continue;
+            }
+            const auto bandEndY = bandY + bandRows - 1;
+            const auto stepsToBand = (raster.dy > 0) ? (bandY - raster.y) : (raster.y - bandEndY);
+            const auto stepsToBandEnd = (raster.dy > 0) ? (bandEndY - raster.y) : (raster.y - bandY);
+            const auto firstStep = std::max<std::int64_t>(0, stepsToBand);
+            const auto lastStep = std::min(raster.length, stepsToBandEnd);
+            for (auto step = firstStep; step <= lastStep; ++step)
+            {
+                const auto x = static_cast<std::size_t>(raster.x + (step * raster.dx));
+                const auto row = static_cast<std::size_t>(raster.y + (step * raster.dy) - bandY);
+                fnMark((row * wordsPerRow) + (x / 64u), std::uint64_t{1} << (x % 64u));
+            }
+        }
+        for (const auto bits : overlapped)
+        {
+            bandCounts[band] += std::popcount(bits);
+        }
+    });
+    return std::accumulate(bandCounts.begin(), bandCounts.end(), std::int64_t{0});
+}
+
 } // namespace
 
 class PuzzleDay05Impl final
@@ -196,23 +786,20 @@ class PuzzleDay05Impl final
     }
 
   public:
-    const std::vector<OceanFloor::Line> floorLines;
+    const OceanFloor::Lines floorLines;
 };
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(05)
 
-PuzzleDay05::PuzzleDay05(const std::string_view input) : pImpl(std::make_unique<PuzzleDay05Impl>(input))
+namespace
 {
-}
-
-PuzzleDay05::~PuzzleDay05() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay05::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay05Impl &impl)
 {
-    if (!pImpl || pImpl->floorLines.empty())
+    if (impl.floorLines.empty())
     {
         return std::monostate{};
     }
-    const auto result = OceanFloor::CalculateOverlappingPoints(pImpl->floorLines);
+    const auto result = OceanFloor::CalculateOverlappingPoints(impl.floorLines);
     if (result < 0)
     {
         return std::monostate{};
@@ -220,13 +807,13 @@ PuzzleDay05::~PuzzleDay05() = default;
     return result;
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay05::Part2()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay05Impl &impl)
 {
-    if (!pImpl || pImpl->floorLines.empty())
+    if (impl.floorLines.empty())
     {
         return std::monostate{};
     }
-    const auto result = OceanFloor::CalculateOverlappingPoints(pImpl->floorLines, false);
+    const auto result = OceanFloor::CalculateOverlappingPoints(impl.floorLines, false);
     if (result < 0)
     {
         return std::monostate{};
@@ -234,6 +821,120 @@ PuzzleDay05::~PuzzleDay05() = default;
     return result;
 }
 
+} // namespace
+
+PuzzleDay05::PuzzleDay05(const std::string_view input) : pImpl(std::make_unique<PuzzleDay05Impl>(input))
+{
+}
+
+PuzzleDay05::~PuzzleDay05() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay05::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay05::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<5>(const std::string_view input)
+{
+    PuzzleDay05Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+class PuzzleDay05OptimizedImpl final
+{
+
+  public:
+    explicit PuzzleDay05OptimizedImpl(std::string_view input) : floorLines(OceanFloor::ParseInput(input))
+    {
+    }
+
+    [[nodiscard]] IPuzzle::Solution_t CountOverlappingPoints(const bool bOnlyHorizontalOrVerticalLines) const
+    {
+        if (floorLines.empty())
+        {
+            return std::monostate{};
+        }
+        const auto result = CountOverlappingPointsSparse(floorLines, bOnlyHorizontalOrVerticalLines);
+        if (!result.has_value())
+        {
+            return std::monostate{};
+        }
+        return result.value();
+    }
+
+  public:
+    const OceanFloor::Lines floorLines;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(05, Optimized)
+
+PuzzleDay05Optimized::PuzzleDay05Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay05OptimizedImpl>(input))
+{
+}
+
+PuzzleDay05Optimized::~PuzzleDay05Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay05Optimized::Part1()
+{
+    return pImpl->CountOverlappingPoints(true);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay05Optimized::Part2()
+{
+    return pImpl->CountOverlappingPoints(false);
+}
+
+class PuzzleDay05ParallelImpl final
+{
+
+  public:
+    explicit PuzzleDay05ParallelImpl(std::string_view input) : floorLines(OceanFloor::ParseInput(input))
+    {
+    }
+
+    [[nodiscard]] IPuzzle::Solution_t CountOverlappingPoints(const bool bOnlyHorizontalOrVerticalLines) const
+    {
+        if (floorLines.empty())
+        {
+            return std::monostate{};
+        }
+        const auto result = CountOverlappingPointsTiled(floorLines, bOnlyHorizontalOrVerticalLines);
+        if (!result.has_value())
+        {
+            return std::monostate{};
+        }
+        return result.value();
+    }
+
+  public:
+    const OceanFloor::Lines floorLines;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(05, Parallel)
+
+PuzzleDay05Parallel::PuzzleDay05Parallel(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay05ParallelImpl>(input))
+{
+}
+
+PuzzleDay05Parallel::~PuzzleDay05Parallel() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay05Parallel::Part1()
+{
+    return pImpl->CountOverlappingPoints(true);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay05Parallel::Part2()
+{
+    return pImpl->CountOverlappingPoints(false);
+}
+
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
 namespace
 {
@@ -255,17 +956,26 @@ namespace
         { {5, 5}, {8, 2} },
     };
     // clang-format on
+    constexpr auto fnParsesTo = [](const std::string_view input, const auto &expected) {
+        const auto lines = OceanFloor::ParseInput(input);
+        for (std::size_t index = 0; index != lines.size(); ++index)
+        {
+            if ((lines[index].startCoord != expected[index].startCoord) ||
+                (lines[index].endCoord != expected[index].endCoord))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
     constexpr auto parsedSize = OceanFloor::ParseInput(exampleInput).size();
     static_assert(parsedSize == std::size(expectedLines), "Day 5: input parsed returs wrong length");
-    constexpr auto parsedLines = Vector2Array<OceanFloor::Line, parsedSize>(OceanFloor::ParseInput(exampleInput));
-    static_assert(std::ranges::equal(
-                      parsedLines, expectedLines, [](const auto &lhs, const auto &rhs) constexpr {
-                          return ((lhs.startCoord == rhs.startCoord) && (lhs.endCoord == rhs.endCoord));
-                      }),
-                  "Day 5: failed to parse input");
-    static_assert(OceanFloor::GetGridDimensions(parsedLines) == OceanFloor::Line::Coordinate{10, 10});
-    static_assert(OceanFloor::CalculateOverlappingPoints(parsedLines) == 5, "Day 5 part 1: error calculating result");
-    static_assert(OceanFloor::CalculateOverlappingPoints(parsedLines, false) == 12,
+    static_assert(fnParsesTo(exampleInput, expectedLines), "Day 5: failed to parse input");
+    static_assert(OceanFloor::ParseInput(exampleInput).minCoord == OceanFloor::Line::Coordinate{0, 0});
+    static_assert(OceanFloor::ParseInput(exampleInput).maxCoord == OceanFloor::Line::Coordinate{9, 9});
+    static_assert(OceanFloor::CalculateOverlappingPoints(OceanFloor::ParseInput(exampleInput)) == 5,
+                  "Day 5 part 1: error calculating result");
+    static_assert(OceanFloor::CalculateOverlappingPoints(OceanFloor::ParseInput(exampleInput), false) == 12,
                   "Day 5 part 2: error calculating result");
 }
 
@@ -1,16 +1,25 @@
 #include "ipuzzle.hpp"
+#include "lanternfish_forecast.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 namespace AOC::Y2021
 {
@@ -18,8 +27,10 @@ namespace AOC::Y2021
 namespace
 {
 
+constexpr std::uint8_t counterRestart{6u};
 constexpr std::uint8_t counterMax{8u};
-using PopulationHistogram = std::array<std::int64_t, counterMax + 1>;
+using PopulationHistogram = LanternfishForecast::PopulationHistogram;
+static_assert(std::tuple_size_v<PopulationHistogram> == (counterMax + 1u));
 
 AOC_Y2021_CONSTEXPR auto ParseInput(std::string_view input)
 {
@@ -43,10 +54,9 @@ AOC_Y2021_CONSTEXPR auto ParseInput(std::string_view input)
 
 template <std::size_t maxDays> consteval auto GeneratePopulationLUT()
 {
-    constexpr std::uint8_t counterRestart{6u};
     std::array<PopulationHistogram, maxDays + 1u> aCache{};
-    auto fnOffspring = [&counterRestart, &aCache](const std::size_t counter, const std::uint64_t days,
-                                                  auto &&recursion) -> std::int64_t {
+    auto fnOffspring = [&aCache](const std::size_t counter, const std::uint64_t days,
+                                 auto &&recursion) -> std::int64_t {
         auto &cacheEntry = aCache[days][counter];
         if (cacheEntry < 1)
         {
@@ -73,14 +83,355 @@ template <std::size_t maxDays> consteval auto GeneratePopulationLUT()
     return histogramMultiplierLUT;
 }
 
+/// Offspring multipliers per timer value for every horizon up to maxDays, advanced day by day
+template <std::size_t maxDays> consteval auto GeneratePopulationLUTs()
+{
+    std::array<PopulationHistogram, maxDays + 1u> aLUTs{};
+    aLUTs[0u].fill(1);
+    for (std::size_t days = 1u; days != aLUTs.size(); ++days)
+    {
+        for (std::size_t counter = 1u; counter != aLUTs[days].size(); ++counter)
+        {
+            aLUTs[days][counter] = aLUTs[days - 1u][counter - 1u];
+        }
+        aLUTs[days][0u] = aLUTs[days - 1u][counterRestart] + aLUTs[days - 1u][counterMax];
+    }
+    return aLUTs;
+}
+
 template <std::size_t maxDays> AOC_Y2021_CONSTEXPR auto SimulatePopulation(const PopulationHistogram &initial)
 {
     constexpr auto offspringLUT = GeneratePopulationLUT<maxDays>();
     return std::inner_product(initial.begin(), initial.end(), offspringLUT.begin(), 0LL);
 }
 
+/// Non-negative std::int64_t that remembers whether an operation leading to it overflowed
+class CheckedInt64 final
+{
+  public:
+    constexpr CheckedInt64() = default;
+
+    constexpr explicit CheckedInt64(const std::int64_t value_) : value(value_), bOverflow(value_ < 0)
+    {
+    }
+
+    friend constexpr CheckedInt64 operator+(const CheckedInt64 &lhs, const CheckedInt64 &rhs)
+    {
+        CheckedInt64 sum;
+        sum.bOverflow = lhs.bOverflow || rhs.bOverflow ||
+                        (lhs.value > (std::numeric_limits<std::int64_t>::max() - rhs.value));
+        sum.value = sum.bOverflow ? 0 : (lhs.value + rhs.value);
+        return sum;
+    }
+
+    friend constexpr CheckedInt64 operator*(const CheckedInt64 &lhs, const CheckedInt64 &rhs)
+    {
+        CheckedInt64 product;
+        product.bOverflow = lhs.bOverflow || rhs.bOverflow ||
+                            ((lhs.value != 0) && (rhs.value > (std::numeric_limits<std::int64_t>::max() / lhs.value)));
+        product.value = product.bOverflow ? 0 : (lhs.value * rhs.value);
+        return product;
+    }
+
+    [[nodiscard]] constexpr std::optional<std::int64_t> Get() const
+    {
+        if (bOverflow)
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+  private:
+    std::int64_t value{0};
+    bool bOverflow{false};
+};
+
+/// Residue modulo a modulus below 2^32, so that the product of two residues fits into 64 bit.
+/// Both operands of an operation must share the modulus.
+class ModularUInt final
+{
+  public:
+    constexpr ModularUInt(const std::int64_t value_, const std::uint32_t modulus_)
+        : value(static_cast<std::uint64_t>(value_) % modulus_), modulus(modulus_)
+    {
+        assert(modulus_ != 0u);
+    }
+
+    friend constexpr ModularUInt operator+(const ModularUInt &lhs, const ModularUInt &rhs)
+    {
+        assert(lhs.modulus == rhs.modulus);
+        return Reduce(lhs.value + rhs.value, lhs.modulus);
+    }
+
+    friend constexpr ModularUInt operator*(const ModularUInt &lhs, const ModularUInt &rhs)
+    {
+        assert(lhs.modulus == rhs.modulus);
+        return Reduce(lhs.value * rhs.value, lhs.modulus);
+    }
+
+    [[nodiscard]] constexpr std::uint32_t Get() const
+    {
+        return static_cast<std::uint32_t>(value);
+    }
+
+  private:
+    static constexpr ModularUInt Reduce(const std::uint64_t value, const std::uint32_t modulus)
+    {
+        return ModularUInt{static_cast<std::int64_t>(value % modulus), modulus};
+    }
+
+  private:
+    std::uint64_t value;
+    std::uint32_t modulus;
+};
+
+/// Unbounded non-negative integer as 32 bit limbs, least significant limb first
+class BigUInt final
+{
+  public:
+    BigUInt() = default;
+
+    explicit BigUInt(const std::int64_t value)
+    {
+        for (auto remaining = static_cast<std::uint64_t>(value); remaining != 0u; remaining >>= 32u)
+        {
+            limbs.push_back(static_cast<std::uint32_t>(remaining));
+        }
+    }
+
+    friend BigUInt operator+(const BigUInt &lhs, const BigUInt &rhs)
+    {
+        const auto &longer = (lhs.limbs.size() >= rhs.limbs.size()) ? lhs.limbs : rhs.limbs;
+        const auto &shorter = (lhs.limbs.size() >= rhs.limbs.size()) ? rhs.limbs : lhs.limbs;
+        BigUInt sum;
+        sum.limbs.reserve(longer.size() + 1u);
+        std::uint64_t carry = 0u;
+        for (std::size_t i = 0; i != longer.size(); ++i)
+        {
+            carry += std::uint64_t{longer[i]} + ((i < shorter.size()) ? shorter[i] : 0u);
+            sum.limbs.push_back(static_cast<std::uint32_t>(carry));
+            carry >>= 32u;
+        }
+        if (carry != 0u)
+        {
+            sum.limbs.push_back(static_cast<std::uint32_t>(carry));
+        }
+        return sum;
+    }
+
+    friend BigUInt operator*(const BigUInt &lhs, const BigUInt &rhs)
+    {
+        BigUInt product;
+        product.limbs = MultiplyLimbs(lhs.limbs, rhs.limbs);
+        return product;
+    }
+
+    [[nodiscard]] std::string Get() const
+    {
+        return ToDecimalString(limbs);
+    }
+
+  private:
+    std::vector<std::uint32_t> limbs;
+};
+
+template <typename Number> using FishCounts = std::array<Number, LanternfishForecast::numTimerValues>;
+template <typename Number> using TransitionMatrix = std::array<FishCounts<Number>, LanternfishForecast::numTimerValues>;
+
+/// Array with the element fnElement(timer) for every timer value. Numbers like ModularUInt have no default value, so
+/// the arrays are never default constructed.
+template <typename Element>
+std::array<Element, LanternfishForecast::numTimerValues> MakeTimerArray(const auto &fnElement)
+{
+    return [&fnElement]<std::size_t... timers>(std::index_sequence<timers...>) {
+        return std::array<Element, sizeof...(timers)>{fnElement(timers)...};
+    }(std::make_index_sequence<LanternfishForecast::numTimerValues>{});
+}
+
+template <typename Number> FishCounts<Number> MakeFishCounts(const PopulationHistogram &initial, const auto &fnNumber)
+{
+    return MakeTimerArray<Number>([&initial, &fnNumber](const std::size_t timer) { return fnNumber(initial[timer]); });
+}
+
+/// One day as matrix acting on the fish counts: every timer counts down, fish at 0 restart at 6 and spawn a fish at 8
+template <typename Number> TransitionMatrix<Number> MakeTransitionMatrix(const auto &fnNumber)
+{
+    return MakeTimerArray<FishCounts<Number>>([&fnNumber](const std::size_t row) {
+        return MakeTimerArray<Number>([&fnNumber, row](const std::size_t col) {
+            const bool bCountsDown = (col == (row + 1u));
+            const bool bSpawns = (col == 0u) && ((row == counterRestart) || (row == counterMax));
+            return fnNumber((bCountsDown || bSpawns) ? 1 : 0);
+        });
+    });
+}
+
+template <typename Number>
+FishCounts<Number> Multiply(const TransitionMatrix<Number> &matrix, const FishCounts<Number> &fish)
+{
+    return MakeTimerArray<Number>([&matrix, &fish](const std::size_t row) {
+        auto sum = matrix[row][0u] * fish[0u];
+        for (std::size_t col = 1u; col != fish.size(); ++col)
+        {
+            sum = sum + (matrix[row][col] * fish[col]);
+        }
+        return sum;
+    });
+}
+
+template <typename Number>
+TransitionMatrix<Number> Multiply(const TransitionMatrix<Number> &lhs, const TransitionMatrix<Number> &rhs)
+{
+    return MakeTimerArray<FishCounts<Number>>([&lhs, &rhs](const std::size_t row) {
+        return MakeTimerArray<Number>([&lhs, &rhs, row](const std::size_t col) {
+            auto sum = lhs[row][0u] * rhs[0u][col];
+            for (std::size_t inner = 1u; inner != rhs.size(); ++inner)
+            {
+                sum = sum + (lhs[row][inner] * rhs[inner][col]);
+            }
+            return sum;
+        });
+    });
+}
+
+template <typename Number> Number SumFishCounts(const FishCounts<Number> &fish)
+{
+    return std::accumulate(std::next(fish.begin()), fish.end(), fish[0u]);
+}
+
+/// Total population after the given days in O(log days) matrix products. fnNumber(value) converts an integer into the
+/// arithmetic of Number.
+template <typename Number>
+Number ForecastPopulation(const PopulationHistogram &initial, std::uint64_t days, const auto &fnNumber)
+{
+    auto fish = MakeFishCounts<Number>(initial, fnNumber);
+    for (auto power = MakeTransitionMatrix<Number>(fnNumber); days != 0u; days >>= 1u)
+    {
+        if ((days & 1u) != 0u)
+        {
+            fish = Multiply(power, fish);
+        }
+        if (days > 1u)
+        {
+            power = Multiply(power, power);
+        }
+    }
+    return SumFishCounts(fish);
+}
+
+template <typename Number> Number ForecastPopulation(const PopulationHistogram &initial, const std::uint64_t days)
+{
+    return ForecastPopulation<Number>(initial, days, [](const std::int64_t value) { return Number{value}; });
+}
+
+/// Total populations after each of the ascending days. Short gaps between consecutive horizons are simulated day by
+/// day, long gaps apply the powers M^(2^i) of the transition matrix, which are squared only once for all horizons.
+template <typename Number>
+std::vector<Number> ForecastPopulations(const PopulationHistogram &initial, const std::span<const std::uint64_t> days,
+                                        const auto &fnNumber)
+{
+    constexpr std::uint64_t maxSimulatedGap = 256u;
+    auto fish = MakeFishCounts<Number>(initial, fnNumber);
+    std::vector<TransitionMatrix<Number>> powers;
+    std::vector<Number> populations;
+    populations.reserve(days.size());
+    std::uint64_t currentDay = 0u;
+    for (const auto day : days)
+    {
+        auto gap = day - currentDay;
+        currentDay = day;
+        if (gap <= maxSimulatedGap)
+        {
+            for (; gap != 0u; --gap)
+            {
+                std::ranges::rotate(fish, fish.begin() + 1);
+                fish[counterRestart] = fish[counterRestart] + fish[counterMax];
+            }
+        }
+        for (std::size_t bit = 0; gap != 0u; ++bit, gap >>= 1u)
+        {
+            if (bit == powers.size())
+            {
+                powers.push_back(powers.empty() ? MakeTransitionMatrix<Number>(fnNumber)
+                                                : Multiply(powers.back(), powers.back()));
+            }
+            if ((gap & 1u) != 0u)
+            {
+                fish = Multiply(powers[bit], fish);
+            }
+        }
+        populations.push_back(SumFishCounts(fish));
+    }
+    return populations;
+}
+
+/// Horizons up to 256 days, which include both puzzle parts, are looked up instead of raising the transition matrix
+constexpr auto populationLUTs = GeneratePopulationLUTs<256u>();
+
+CheckedInt64 ForecastPopulationFromLUT(const PopulationHistogram &initial, const PopulationHistogram &offspringLUT)
+{
+    CheckedInt64 population{0};
+    for (std::size_t counter = 0; counter != initial.size(); ++counter)
+    {
+        population = population + (CheckedInt64{initial[counter]} * CheckedInt64{offspringLUT[counter]});
+    }
+    return population;
+}
+
 } // namespace
 
+LanternfishForecast::LanternfishForecast(const PopulationHistogram &initial_) : initial(initial_)
+{
+}
+
+std::optional<std::int64_t> LanternfishForecast::GetPopulation(const std::uint64_t days) const
+{
+    if (days < populationLUTs.size())
+    {
+        return ForecastPopulationFromLUT(initial, populationLUTs[days]).Get();
+    }
+    return ForecastPopulation<CheckedInt64>(initial, days).Get();
+}
+
+std::vector<std::optional<std::int64_t>> LanternfishForecast::GetPopulations(
+    const std::span<const std::uint64_t> sortedDays) const
+{
+    std::vector<std::optional<std::int64_t>> populations;
+    if (!std::ranges::is_sorted(sortedDays))
+    {
+        return populations;
+    }
+    populations.reserve(sortedDays.size());
+    for (const auto &population : ForecastPopulations<CheckedInt64>(
+             initial, sortedDays, [](const std::int64_t value) { return CheckedInt64{value}; }))
+    {
+        populations.push_back(population.Get());
+    }
+    return populations;
+}
+
+std::optional<std::string> LanternfishForecast::GetPopulation128(const std::uint64_t days) const
+{
+    return ForecastPopulation<CheckedUInt128>(initial, days).Get();
+}
+
+std::optional<std::uint32_t> LanternfishForecast::GetPopulationModulo(const std::uint64_t days,
+                                                                      const std::uint32_t modulus) const
+{
+    if (modulus == 0u)
+    {
+        return std::nullopt;
+    }
+    return ForecastPopulation<ModularUInt>(initial, days, [modulus](const std::int64_t value) {
+               return ModularUInt{value, modulus};
+           }).Get();
+}
+
+std::string LanternfishForecast::GetExactPopulation(const std::uint64_t days) const
+{
+    return ForecastPopulation<BigUInt>(initial, days).Get();
+}
+
 class PuzzleDay06Impl final
 {
 
@@ -94,19 +445,22 @@ class PuzzleDay06Impl final
 };
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(06)
 
-PuzzleDay06::PuzzleDay06(const std::string_view input) : pImpl(std::make_unique<PuzzleDay06Impl>(input))
+namespace
 {
-}
-
-PuzzleDay06::~PuzzleDay06() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay06::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay06Impl &impl)
 {
-    if (!pImpl)
+    const auto result = SimulatePopulation<80>(impl.fish);
+    if (result < 0)
     {
         return std::monostate{};
     }
-    const auto result = SimulatePopulation<80>(pImpl->fish);
+    return result;
+}
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay06Impl &impl)
+{
+    const auto result = SimulatePopulation<256>(impl.fish);
     if (result < 0)
     {
         return std::monostate{};
@@ -114,18 +468,69 @@ PuzzleDay06::~PuzzleDay06() = default;
     return result;
 }
 
+} // namespace
+
+PuzzleDay06::PuzzleDay06(const std::string_view input) : pImpl(std::make_unique<PuzzleDay06Impl>(input))
+{
+}
+
+PuzzleDay06::~PuzzleDay06() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay06::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay06::Part2()
 {
-    if (!pImpl)
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<6>(const std::string_view input)
+{
+    PuzzleDay06Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+class PuzzleDay06OptimizedImpl final
+{
+
+  public:
+    explicit PuzzleDay06OptimizedImpl(std::string_view input) : forecast(ParseInput(input))
     {
-        return std::monostate{};
     }
-    const auto result = SimulatePopulation<256>(pImpl->fish);
-    if (result < 0)
+
+    [[nodiscard]] IPuzzle::Solution_t GetPopulation(const std::uint64_t days) const
     {
-        return std::monostate{};
+        const auto population = forecast.GetPopulation(days);
+        if (!population.has_value())
+        {
+            return forecast.GetExactPopulation(days);
+        }
+        return population.value();
     }
-    return result;
+
+  public:
+    const LanternfishForecast forecast;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(06, Optimized)
+
+PuzzleDay06Optimized::PuzzleDay06Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay06OptimizedImpl>(input))
+{
+}
+
+PuzzleDay06Optimized::~PuzzleDay06Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay06Optimized::Part1()
+{
+    return pImpl->GetPopulation(80u);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay06Optimized::Part2()
+{
+    return pImpl->GetPopulation(256u);
 }
 
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
@@ -143,6 +548,8 @@ namespace
     static_assert(SimulatePopulation<80>(parsedPopulation) == 5'934LL, "Day 6 part 1: error calculating result");
     static_assert(SimulatePopulation<256>(parsedPopulation) == 26'984'457'539LL,
                   "Day 6 part 2: error calculating result");
+    static_assert(GeneratePopulationLUTs<80>()[80] == GeneratePopulationLUT<80>(),
+                  "Day 6: error generating lookup tables");
 }
 
 } // namespace
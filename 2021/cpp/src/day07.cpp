@@ -1,13 +1,17 @@
+#include "crab_alignment.hpp"
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
-#include <numeric>
+#include <ranges>
+#include <span>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -30,40 +34,68 @@ AOC_Y2021_CONSTEXPR auto ParseInput(std::string_view input)
     return posistionHistogram;
 }
 
-AOC_Y2021_CONSTEXPR std::int64_t CalculateFuelConsumption(const auto &positionHistogram, const std::size_t position,
-                                                          const bool bConstantFuelBurn)
+/// Fuel to align all crabs at the position. If the fuel is known to fit into 64 bit, it is accumulated in 64 bit by a
+/// vectorizable kernel, otherwise in 128 bit.
+AOC_Y2021_CONSTEXPR CheckedUInt128 CalculateFuelConsumption(const auto &positionHistogram, const std::size_t position,
+                                                            const bool bConstantFuelBurn, const bool bFitsUInt64)
 {
     if (position >= positionHistogram.size())
     {
-        return -__LINE__;
+        return CheckedUInt128{-__LINE__};
     }
 
-    std::size_t index{}; /// Caution: Do NOT to parallelize this algo
-    const auto fuel =
-        std::accumulate(positionHistogram.begin(), positionHistogram.end(), 0u,
-                        [&index, &position, &bConstantFuelBurn](const auto &acc, const auto &rhs) {
-                            const auto n =
-                                static_cast<uint32_t>((index > position) ? (index - position) : (position - index));
-                            ++index;
-                            const decltype(n) weightedFactor = (bConstantFuelBurn) ? n : ((n * (n + 1u)) / 2u);
-                            const auto fuel = weightedFactor * rhs;
-                            return acc + fuel;
-                        });
-    return fuel;
+    const auto fnWeightedFactor = [position, bConstantFuelBurn](const std::size_t index) {
+        const auto n = static_cast<std::uint64_t>((index > position) ? (index - position) : (position - index));
+        return (bConstantFuelBurn) ? n : ((n * (n + 1u)) / 2u);
+    };
+    if (!bFitsUInt64)
+    {
+        CheckedUInt128 fuel;
+        for (std::size_t index = 0; index != positionHistogram.size(); ++index)
+        {
+            fuel = fuel + (CheckedUInt128::FromUInt64(fnWeightedFactor(index)) *
+                           CheckedUInt128::FromUInt64(positionHistogram[index]));
+        }
+        return fuel;
+    }
+
+    // a plain reduction over contiguous counts, which the compiler vectorizes into 64 bit lanes
+    const auto *const pCounts = positionHistogram.data();
+    std::uint64_t fuel = 0u;
+    for (std::size_t index = 0; index != positionHistogram.size(); ++index)
+    {
+        fuel += fnWeightedFactor(index) * pCounts[index];
+    }
+    return CheckedUInt128::FromUInt64(fuel);
 }
 
-AOC_Y2021_CONSTEXPR std::int64_t CalculateCheapestFuelOption(const auto &posistionHistogram,
-                                                             const bool bConstantFuelBurn)
+/// whether the fuel of every position fits into 64 bit, as no fuel exceeds all crabs moving the maximum distance
+AOC_Y2021_CONSTEXPR bool IsFuelWithinUInt64(const auto &positionHistogram, const bool bConstantFuelBurn)
+{
+    const auto maxDistance = static_cast<std::uint64_t>(positionHistogram.size() - 1u);
+    const auto maxWeightedFactor = (bConstantFuelBurn) ? maxDistance : ((maxDistance * (maxDistance + 1u)) / 2u);
+    CheckedUInt128 numCrabs;
+    for (const auto count : positionHistogram)
+    {
+        numCrabs = numCrabs + CheckedUInt128::FromUInt64(count);
+    }
+    return (numCrabs * CheckedUInt128::FromUInt64(maxWeightedFactor)).GetUInt64().has_value();
+}
+
+AOC_Y2021_CONSTEXPR CheckedUInt128 CalculateCheapestFuelOption(const auto &posistionHistogram,
+                                                               const bool bConstantFuelBurn)
 {
     if (posistionHistogram.empty())
     {
-        return -__LINE__;
+        return CheckedUInt128{-__LINE__};
     }
 
-    auto minFuel = CalculateFuelConsumption(posistionHistogram, 0, bConstantFuelBurn);
+    const bool bFitsUInt64 = IsFuelWithinUInt64(posistionHistogram, bConstantFuelBurn);
+
+    auto minFuel = CalculateFuelConsumption(posistionHistogram, 0, bConstantFuelBurn, bFitsUInt64);
     for (std::size_t pos = 1; pos != posistionHistogram.size(); ++pos)
     {
-        const auto fuel = CalculateFuelConsumption(posistionHistogram, pos, bConstantFuelBurn);
+        const auto fuel = CalculateFuelConsumption(posistionHistogram, pos, bConstantFuelBurn, bFitsUInt64);
         if (fuel < minFuel)
         {
             minFuel = fuel;
@@ -72,6 +104,181 @@ AOC_Y2021_CONSTEXPR std::int64_t CalculateCheapestFuelOption(const auto &posisti
     return minFuel;
 }
 
+/// Number of crabs and sums of their 32 bit positions and squared positions. Counts and position sums fit into 64 bit
+/// for less than 2^31 crabs, the squares need 128 bit.
+struct CrabMoments
+{
+    std::int64_t count{0};
+    std::int64_t sum{0};
+    CheckedUInt128 sumOfSquares;
+
+    AOC_Y2021_CONSTEXPR void Add(const std::int64_t position, const std::int64_t numCrabs)
+    {
+        count += numCrabs;
+        sum += position * numCrabs;
+        sumOfSquares = sumOfSquares + (CheckedUInt128{position} * CheckedUInt128{position} * CheckedUInt128{numCrabs});
+    }
+};
+
+/// Fuel to align all crabs at the position in O(1), given the moments of the crabs below the position and of all crabs.
+/// Every difference is evaluated in the order that keeps it non-negative.
+AOC_Y2021_CONSTEXPR CheckedUInt128 CalculateFuelFromMoments(const CrabMoments &below, const CrabMoments &total,
+                                                            const std::int64_t position, const bool bConstantFuelBurn)
+{
+    const CheckedUInt128 wide{position};
+    const auto linearFuelBelow = (wide * CheckedUInt128{below.count}) - CheckedUInt128{below.sum};
+    const auto linearFuelAbove =
+        CheckedUInt128{total.sum - below.sum} - (wide * CheckedUInt128{total.count - below.count});
+    const auto linearFuel = linearFuelBelow + linearFuelAbove;
+    if (bConstantFuelBurn)
+    {
+        return linearFuel;
+    }
+    // sum of n * (n + 1) / 2 is half of the sum of n^2 plus the sum of n
+    const auto squaredFuel = (total.sumOfSquares + (wide * wide * CheckedUInt128{total.count})) -
+                             (CheckedUInt128{2} * wide * CheckedUInt128{total.sum});
+    return (squaredFuel + linearFuel) >> 1u;
+}
+
+/// Part 1 is cheapest at the median, part 2 at most one position away from the mean. fnMomentsBelow(position) returns
+/// the moments of the crabs below the position.
+AOC_Y2021_CONSTEXPR CheckedUInt128 CalculateCheapestFuelAtCandidates(const auto &fnMomentsBelow,
+                                                                     const CrabMoments &total,
+                                                                     const std::int64_t median,
+                                                                     const std::int64_t maxPosition,
+                                                                     const bool bConstantFuelBurn)
+{
+    if (total.count == 0)
+    {
+        return CheckedUInt128{-__LINE__};
+    }
+    if (bConstantFuelBurn)
+    {
+        return CalculateFuelFromMoments(fnMomentsBelow(median), total, median, true);
+    }
+    const auto mean = total.sum / total.count;
+    auto minFuel = CalculateFuelFromMoments(fnMomentsBelow(mean), total, mean, false);
+    for (const auto position : {mean - 1, mean + 1})
+    {
+        if ((position >= 0) && (position <= maxPosition))
+        {
+            minFuel = std::min(minFuel, CalculateFuelFromMoments(fnMomentsBelow(position), total, position, false));
+        }
+    }
+    return minFuel;
+}
+
+/// O(n + range): prefix moments over the position histogram make the fuel of any candidate O(1)
+AOC_Y2021_CONSTEXPR CheckedUInt128 CalculateCheapestFuelFromHistogram(const auto &positionHistogram,
+                                                                      const bool bConstantFuelBurn)
+{
+    std::vector<CrabMoments> prefixMoments(positionHistogram.size() + 1u);
+    for (std::size_t pos = 0; pos != positionHistogram.size(); ++pos)
+    {
+        prefixMoments[pos + 1u] = prefixMoments[pos];
+        prefixMoments[pos + 1u].Add(static_cast<std::int64_t>(pos), static_cast<std::int64_t>(positionHistogram[pos]));
+    }
+    const auto &total = prefixMoments.back();
+    const auto median = std::ranges::find_if(prefixMoments, [&total](const auto &moments) {
+                            return (2 * moments.count) >= total.count;
+                        }) - prefixMoments.begin() - 1;
+    return CalculateCheapestFuelAtCandidates(
+        [&prefixMoments](const std::int64_t position) { return prefixMoments[static_cast<std::size_t>(position)]; },
+        total, std::max(median, std::ptrdiff_t{0}), static_cast<std::int64_t>(positionHistogram.size()) - 1,
+        bConstantFuelBurn);
+}
+
+/// Crab positions compressed to the sorted distinct positions and the number of crabs at each of them
+struct CrabPositions
+{
+    std::vector<std::uint32_t> positions;
+    std::vector<std::uint32_t> counts;
+
+    static AOC_Y2021_CONSTEXPR CrabPositions Compress(std::vector<std::uint32_t> crabs)
+    {
+        std::ranges::sort(crabs);
+        CrabPositions compressed;
+        for (const auto crab : crabs)
+        {
+            if (compressed.positions.empty() || (compressed.positions.back() != crab))
+            {
+                compressed.positions.push_back(crab);
+                compressed.counts.push_back(0u);
+            }
+            ++compressed.counts.back();
+        }
+        return compressed;
+    }
+};
+
+/// O(n log n) without range sized arrays: prefix moments over the compressed positions, relative to the leftmost crab.
+/// The moments below a position are found by binary search, part 2 searches the convex fuel for the first position at
+/// which it stops falling.
+AOC_Y2021_CONSTEXPR CheckedUInt128 CalculateCheapestFuelFromCompressed(const CrabPositions &crabs,
+                                                                       const bool bConstantFuelBurn)
+{
+    if (crabs.positions.empty())
+    {
+        return CheckedUInt128{-__LINE__};
+    }
+    const std::int64_t origin = crabs.positions.front();
+    std::vector<CrabMoments> prefixMoments(crabs.positions.size() + 1u);
+    for (std::size_t i = 0; i != crabs.positions.size(); ++i)
+    {
+        prefixMoments[i + 1u] = prefixMoments[i];
+        prefixMoments[i + 1u].Add(crabs.positions[i] - origin, crabs.counts[i]);
+    }
+    const auto &total = prefixMoments.back();
+    const auto fnFuel = [&](const std::int64_t position) {
+        const auto below = std::ranges::lower_bound(crabs.positions, position + origin, {}, [](const auto crab) {
+                               return static_cast<std::int64_t>(crab);
+                           }) -
+                           crabs.positions.begin();
+        return CalculateFuelFromMoments(prefixMoments[static_cast<std::size_t>(below)], total, position,
+                                        bConstantFuelBurn);
+    };
+    if (bConstantFuelBurn)
+    {
+        const auto median = std::ranges::find_if(prefixMoments.begin() + 1, prefixMoments.end(),
+                                                 [&total](const auto &moments) {
+                                                     return (2 * moments.count) >= total.count;
+                                                 }) -
+                            prefixMoments.begin() - 1;
+        return fnFuel(crabs.positions[static_cast<std::size_t>(median)] - origin);
+    }
+    std::int64_t low = 0;
+    std::int64_t high = crabs.positions.back() - origin;
+    while (low < high)
+    {
+        const auto middle = low + ((high - low) / 2);
+        if (!(fnFuel(middle + 1) < fnFuel(middle)))
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    return fnFuel(low);
+}
+
+/// the fuel as std::int64_t if it fits, otherwise as decimal string
+IPuzzle::Solution_t ToSolution(const CheckedUInt128 &fuel)
+{
+    const auto fuel64 = fuel.GetUInt64();
+    if (fuel64.has_value() && (fuel64.value() <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())))
+    {
+        return static_cast<std::int64_t>(fuel64.value());
+    }
+    const auto decimal = fuel.Get();
+    if (!decimal.has_value())
+    {
+        return std::monostate{};
+    }
+    return decimal.value();
+}
+
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
 namespace
 {
@@ -87,14 +294,39 @@ namespace
     constexpr auto parsedInput = Vector2Array<std::uint32_t, parsedSize>(ParseInput(exampleInput));
     static_assert(std::equal(parsedInput.begin(), parsedInput.end(), std::begin(expectedParsedInput)),
                   "Day 7: failed to parse input");
-    static_assert(CalculateCheapestFuelOption(parsedInput, true) == 37, "Day 7 part 1: error calculating result");
-    static_assert(CalculateCheapestFuelOption(parsedInput, false) == 168, "Day 7 part 2: error calculating result");
+    static_assert(CalculateCheapestFuelOption(parsedInput, true).GetUInt64() == 37u,
+                  "Day 7 part 1: error calculating result");
+    static_assert(CalculateCheapestFuelOption(parsedInput, false).GetUInt64() == 168u,
+                  "Day 7 part 2: error calculating result");
+    static_assert(CalculateFuelConsumption(parsedInput, 2u, true, false).GetUInt64() == 37u,
+                  "Day 7 part 1: error calculating result");
+    static_assert(CalculateFuelConsumption(parsedInput, 5u, false, false).GetUInt64() == 168u,
+                  "Day 7 part 2: error calculating result");
+    static_assert(CalculateCheapestFuelFromHistogram(parsedInput, true).GetUInt64() == 37u,
+                  "Day 7 part 1: error calculating result");
+    static_assert(CalculateCheapestFuelFromHistogram(parsedInput, false).GetUInt64() == 168u,
+                  "Day 7 part 2: error calculating result");
+    static_assert(CalculateCheapestFuelFromCompressed(
+                      CrabPositions::Compress(ParseToVectorOfNums<std::uint32_t, ','>(exampleInput)), true)
+                          .GetUInt64() == 37u,
+                  "Day 7 part 1: error calculating result");
+    static_assert(CalculateCheapestFuelFromCompressed(
+                      CrabPositions::Compress(ParseToVectorOfNums<std::uint32_t, ','>(exampleInput)), false)
+                          .GetUInt64() == 168u,
+                  "Day 7 part 2: error calculating result");
 }
 } // namespace
 #endif // AOC_Y2021_CONSTEXPR_UNIT_TEST
 
 } // namespace
 
+IPuzzle::Solution_t CalculateAlignmentFuel(const std::span<const std::uint64_t> positionHistogram,
+                                           const std::size_t position, const bool bConstantFuelBurn)
+{
+    return ToSolution(CalculateFuelConsumption(positionHistogram, position, bConstantFuelBurn,
+                                               IsFuelWithinUInt64(positionHistogram, bConstantFuelBurn)));
+}
+
 class PuzzleDay07Impl final
 {
 
@@ -109,27 +341,113 @@ class PuzzleDay07Impl final
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(07)
 
-PuzzleDay07::PuzzleDay07(const std::string_view input) : pImpl(std::make_unique<PuzzleDay07Impl>(input))
+namespace
+{
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay07Impl &impl)
 {
+    if (impl.crabPosHistogram.empty())
+    {
+        return std::monostate{};
+    }
+    return ToSolution(CalculateCheapestFuelOption(impl.crabPosHistogram, true));
 }
-PuzzleDay07::~PuzzleDay07() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay07::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay07Impl &impl)
 {
-    if (!pImpl || pImpl->crabPosHistogram.empty())
+    if (impl.crabPosHistogram.empty())
     {
         return std::monostate{};
     }
-    return CalculateCheapestFuelOption(pImpl->crabPosHistogram, true);
+    return ToSolution(CalculateCheapestFuelOption(impl.crabPosHistogram, false));
+}
+
+} // namespace
+
+PuzzleDay07::PuzzleDay07(const std::string_view input) : pImpl(std::make_unique<PuzzleDay07Impl>(input))
+{
+}
+PuzzleDay07::~PuzzleDay07() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay07::Part1()
+{
+    return SolvePart1(*pImpl);
 }
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay07::Part2()
 {
-    if (!pImpl || pImpl->crabPosHistogram.empty())
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<7>(const std::string_view input)
+{
+    PuzzleDay07Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+class PuzzleDay07OptimizedImpl final
+{
+
+  public:
+    explicit PuzzleDay07OptimizedImpl(std::string_view input)
+    {
+        auto crabs = ParseToVectorOfNums<std::uint32_t, ','>(input);
+        if (crabs.empty())
+        {
+            return;
+        }
+        // a histogram pays off as long as it is not much larger than the sort of the crabs
+        constexpr std::size_t maxHistogramSizePerCrab = 16u;
+        const auto maxPosition = *std::ranges::max_element(crabs);
+        if ((maxPosition / maxHistogramSizePerCrab) < crabs.size())
+        {
+            crabPosHistogram.resize(std::size_t{maxPosition} + 1u);
+            for (const auto position : crabs)
+            {
+                ++crabPosHistogram[position];
+            }
+        }
+        else
+        {
+            compressedCrabs = CrabPositions::Compress(std::move(crabs));
+        }
+    }
+
+    [[nodiscard]] IPuzzle::Solution_t CalculateCheapestFuel(const bool bConstantFuelBurn) const
     {
+        if (!crabPosHistogram.empty())
+        {
+            return ToSolution(CalculateCheapestFuelFromHistogram(crabPosHistogram, bConstantFuelBurn));
+        }
+        if (!compressedCrabs.positions.empty())
+        {
+            return ToSolution(CalculateCheapestFuelFromCompressed(compressedCrabs, bConstantFuelBurn));
+        }
         return std::monostate{};
     }
-    return CalculateCheapestFuelOption(pImpl->crabPosHistogram, false);
+
+  private:
+    std::vector<std::uint32_t> crabPosHistogram;
+    CrabPositions compressedCrabs;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(07, Optimized)
+
+PuzzleDay07Optimized::PuzzleDay07Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay07OptimizedImpl>(input))
+{
+}
+
+PuzzleDay07Optimized::~PuzzleDay07Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay07Optimized::Part1()
+{
+    return pImpl->CalculateCheapestFuel(true);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay07Optimized::Part2()
+{
+    return pImpl->CalculateCheapestFuel(false);
 }
 
 } // namespace AOC::Y2021
@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -265,6 +266,82 @@ AOC_Y2021_CONSTEXPR std::int64_t AccumulateRestoredDisplayValues(const auto &dis
     });
 }
 
+constexpr std::size_t numSegments = (segMax - segMin) + 1;
+
+/// how many of the ten digit patterns light up each segment
+constexpr auto CountSegmentFrequencies(const std::array<SegmentRepresentation, 10u> &patterns)
+{
+    std::array<std::uint8_t, numSegments> frequencies{};
+    for (std::size_t segment = 0; segment != numSegments; ++segment)
+    {
+        for (const auto pattern : patterns)
+        {
+            frequencies[segment] = static_cast<std::uint8_t>(frequencies[segment] + ((pattern >> segment) & 1u));
+        }
+    }
+    return frequencies;
+}
+
+/// Sum of the frequencies of the segments of the pattern. It identifies a digit regardless of the wiring, because the
+/// wiring only permutes the segments together with their frequencies.
+constexpr std::uint8_t CalculateSignature(const std::array<std::uint8_t, numSegments> &frequencies,
+                                          const SegmentRepresentation pattern)
+{
+    std::uint8_t signature = 0u;
+    for (std::size_t segment = 0; segment != numSegments; ++segment)
+    {
+        signature = static_cast<std::uint8_t>(signature + (((pattern >> segment) & 1u) * frequencies[segment]));
+    }
+    return signature;
+}
+
+/// digit per signature, -1 for signatures of no digit
+constexpr auto signatureToDigit = []() {
+    std::array<std::int8_t, (numSegments * correctRepresentations.size()) + 1u> table{};
+    table.fill(-1);
+    const auto frequencies = CountSegmentFrequencies(correctRepresentations);
+    for (std::size_t digit = 0; digit != correctRepresentations.size(); ++digit)
+    {
+        table[CalculateSignature(frequencies, correctRepresentations[digit])] = static_cast<std::int8_t>(digit);
+    }
+    return table;
+}();
+static_assert(std::ranges::count_if(signatureToDigit, [](const auto digit) { return digit >= 0; }) ==
+                  static_cast<std::ptrdiff_t>(correctRepresentations.size()),
+              "Day 08: digit signatures are not unique");
+
+/// decodes the output digits by table lookup of their signatures, without deducing the wiring
+AOC_Y2021_CONSTEXPR std::int64_t DecodeDisplayValue(const DisplayPatternAndValue &display)
+{
+    const auto frequencies = CountSegmentFrequencies(display.first);
+    std::int64_t ret = 0;
+    for (const auto pattern : display.second)
+    {
+        const auto digit = signatureToDigit[CalculateSignature(frequencies, pattern)];
+        if (digit < 0)
+        {
+            return -__LINE__;
+        }
+        ret = (ret * 10) + digit;
+    }
+    return ret;
+}
+
+AOC_Y2021_CONSTEXPR std::int64_t AccumulateDecodedDisplayValues(const auto &displays)
+{
+    std::int64_t sum = 0;
+    for (const auto &display : displays)
+    {
+        const auto value = DecodeDisplayValue(display);
+        if (value < 0)
+        {
+            return value;
+        }
+        sum += value;
+    }
+    return sum;
+}
+
 #if AOC_Y2021_CONSTEXPR_UNIT_TEST
 namespace
 {
@@ -298,6 +375,9 @@ namespace
 
     static_assert(AccumulateRestoredDisplayValues(ParseInput(longExample)) == 61229,
                   "Day 8 part 2: error calculating result");
+    static_assert(DecodeDisplayValue(ParseInput(shortExample)[0]) == 5353, "Day 8 part 2: error decoding display");
+    static_assert(AccumulateDecodedDisplayValues(ParseInput(longExample)) == 61229,
+                  "Day 8 part 2: error calculating result");
 }
 } // namespace
 #endif // AOC_Y2021_CONSTEXPR_UNIT_TEST
@@ -320,19 +400,17 @@ class PuzzleDay08Impl final
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(08)
 
-PuzzleDay08::PuzzleDay08(const std::string_view input) : pImpl(std::make_unique<PuzzleDay08Impl>(input))
+namespace
 {
-}
-PuzzleDay08::~PuzzleDay08() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay08::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay08Impl &impl)
 {
     IPuzzle::Solution_t ret = std::monostate{};
-    if (!pImpl || pImpl->displays.empty())
+    if (impl.displays.empty())
     {
         return ret;
     }
-    const auto result = Day08::CountEasilyTdentifiableDigits(pImpl->displays);
+    const auto result = Day08::CountEasilyTdentifiableDigits(impl.displays);
     if (result >= 0)
     {
         ret = result;
@@ -340,14 +418,14 @@ PuzzleDay08::~PuzzleDay08() = default;
     return ret;
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay08::Part2()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay08Impl &impl)
 {
     IPuzzle::Solution_t ret = std::monostate{};
-    if (!pImpl || pImpl->displays.empty())
+    if (impl.displays.empty())
     {
         return ret;
     }
-    const auto result = Day08::AccumulateRestoredDisplayValues(pImpl->displays);
+    const auto result = Day08::AccumulateRestoredDisplayValues(impl.displays);
     if (result >= 0)
     {
         ret = result;
@@ -355,4 +433,81 @@ PuzzleDay08::~PuzzleDay08() = default;
     return ret;
 }
 
+} // namespace
+
+PuzzleDay08::PuzzleDay08(const std::string_view input) : pImpl(std::make_unique<PuzzleDay08Impl>(input))
+{
+}
+PuzzleDay08::~PuzzleDay08() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay08::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay08::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<8>(const std::string_view input)
+{
+    PuzzleDay08Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+class PuzzleDay08OptimizedImpl final
+{
+
+  public:
+    explicit PuzzleDay08OptimizedImpl(std::string_view input) : displays(Day08::ParseInput(input))
+    {
+    }
+
+    [[nodiscard]] IPuzzle::Solution_t CountEasilyIdentifiableDigits() const
+    {
+        if (displays.empty())
+        {
+            return std::monostate{};
+        }
+        return static_cast<std::int64_t>(Day08::CountEasilyTdentifiableDigits(displays));
+    }
+
+    [[nodiscard]] IPuzzle::Solution_t AccumulateDisplayValues() const
+    {
+        if (displays.empty())
+        {
+            return std::monostate{};
+        }
+        const auto result = Day08::AccumulateDecodedDisplayValues(displays);
+        if (result < 0)
+        {
+            return std::monostate{};
+        }
+        return result;
+    }
+
+  public:
+    const std::vector<Day08::DisplayPatternAndValue> displays;
+};
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(08, Optimized)
+
+PuzzleDay08Optimized::PuzzleDay08Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay08OptimizedImpl>(input))
+{
+}
+
+PuzzleDay08Optimized::~PuzzleDay08Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay08Optimized::Part1()
+{
+    return pImpl->CountEasilyIdentifiableDigits();
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay08Optimized::Part2()
+{
+    return pImpl->AccumulateDisplayValues();
+}
+
 } // namespace AOC::Y2021
@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -221,20 +222,18 @@ class PuzzleDay09Impl final
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(09)
 
-PuzzleDay09::PuzzleDay09(const std::string_view input) : pImpl(std::make_unique<PuzzleDay09Impl>(input))
+namespace
 {
-}
-PuzzleDay09::~PuzzleDay09() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay09::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay09Impl &impl)
 {
     IPuzzle::Solution_t ret = std::monostate{};
-    if (!pImpl || pImpl->parsedInput.empty())
+    if (impl.parsedInput.empty())
     {
         return ret;
     }
-    pImpl->lowPointMap = Day09::FindLowPoints(pImpl->parsedInput);
-    const auto result = Day09::AccumulatedRiskLevelOfLowPoints(pImpl->parsedInput, pImpl->lowPointMap);
+    impl.lowPointMap = Day09::FindLowPoints(impl.parsedInput);
+    const auto result = Day09::AccumulatedRiskLevelOfLowPoints(impl.parsedInput, impl.lowPointMap);
     if (result >= 0)
     {
         ret = result;
@@ -242,19 +241,19 @@ PuzzleDay09::~PuzzleDay09() = default;
     return ret;
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay09::Part2()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay09Impl &impl)
 {
     IPuzzle::Solution_t ret = std::monostate{};
-    if (!pImpl || pImpl->parsedInput.empty())
+    if (impl.parsedInput.empty())
     {
         return ret;
     }
-    if (pImpl->lowPointMap.empty())
+    if (impl.lowPointMap.empty())
     {
-        pImpl->lowPointMap = Day09::FindLowPoints(pImpl->parsedInput);
+        impl.lowPointMap = Day09::FindLowPoints(impl.parsedInput);
     }
-    pImpl->lowPointMap = Day09::FindLowPoints(pImpl->parsedInput);
-    const auto result = Day09::MultiplyBasinAreas<3>(pImpl->parsedInput, pImpl->lowPointMap);
+    impl.lowPointMap = Day09::FindLowPoints(impl.parsedInput);
+    const auto result = Day09::MultiplyBasinAreas<3>(impl.parsedInput, impl.lowPointMap);
     if (result >= 0)
     {
         ret = result;
@@ -262,6 +261,29 @@ PuzzleDay09::~PuzzleDay09() = default;
     return ret;
 }
 
+} // namespace
+
+PuzzleDay09::PuzzleDay09(const std::string_view input) : pImpl(std::make_unique<PuzzleDay09Impl>(input))
+{
+}
+PuzzleDay09::~PuzzleDay09() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay09::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay09::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<9>(const std::string_view input)
+{
+    PuzzleDay09Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
 #endif // defined(AOC_Y2021_PUZZLE_CLASS_DECLARATION)
 
 } // namespace AOC::Y2021
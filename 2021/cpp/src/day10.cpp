@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -174,18 +175,16 @@ class PuzzleDay10Impl final
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(10)
 
-PuzzleDay10::PuzzleDay10(const std::string_view input) : pImpl(std::make_unique<PuzzleDay10Impl>(input))
+namespace
 {
-}
-PuzzleDay10::~PuzzleDay10() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay10::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay10Impl &impl)
 {
-    if (!pImpl || pImpl->input.empty())
+    if (impl.input.empty())
     {
         return std::monostate{};
     }
-    const auto result = Day10::CalculateScore(pImpl->input, false);
+    const auto result = Day10::CalculateScore(impl.input, false);
     if (result < 0)
     {
         return std::monostate{};
@@ -196,13 +195,13 @@ PuzzleDay10::~PuzzleDay10() = default;
     }
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay10::Part2()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay10Impl &impl)
 {
-    if (!pImpl || pImpl->input.empty())
+    if (impl.input.empty())
     {
         return std::monostate{};
     }
-    const auto result = Day10::CalculateScore(pImpl->input, true);
+    const auto result = Day10::CalculateScore(impl.input, true);
     if (result < 0)
     {
         return std::monostate{};
@@ -213,4 +212,27 @@ PuzzleDay10::~PuzzleDay10() = default;
     }
 }
 
+} // namespace
+
+PuzzleDay10::PuzzleDay10(const std::string_view input) : pImpl(std::make_unique<PuzzleDay10Impl>(input))
+{
+}
+PuzzleDay10::~PuzzleDay10() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay10::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay10::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<10>(const std::string_view input)
+{
+    PuzzleDay10Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
 } // namespace AOC::Y2021
@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -171,28 +172,18 @@ namespace
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(11)
 
-PuzzleDay11::PuzzleDay11(const std::string_view input) : pImpl(std::make_unique<PuzzleDay11Impl>(input))
+namespace
 {
-}
-PuzzleDay11::~PuzzleDay11() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay11::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay11Impl &impl)
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    const auto result = pImpl->RunSteps(100);
+    const auto result = impl.RunSteps(100);
     return result;
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay11::Part2()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay11Impl &impl)
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    const auto result = pImpl->FindStepInWhichAllAreFlashing();
+    const auto result = impl.FindStepInWhichAllAreFlashing();
     if (result < 0)
     {
         return std::monostate{};
@@ -203,4 +194,27 @@ PuzzleDay11::~PuzzleDay11() = default;
     }
 }
 
+} // namespace
+
+PuzzleDay11::PuzzleDay11(const std::string_view input) : pImpl(std::make_unique<PuzzleDay11Impl>(input))
+{
+}
+PuzzleDay11::~PuzzleDay11() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay11::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay11::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<11>(const std::string_view input)
+{
+    PuzzleDay11Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
 } // namespace AOC::Y2021
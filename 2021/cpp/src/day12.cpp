@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -224,19 +225,12 @@ class PuzzleDay12Impl final
     Day12::Graph graph;
 };
 
-PuzzleDay12::PuzzleDay12(const std::string_view input)
-    : pImpl(std::make_unique<PuzzleDay12Impl>(input))
+namespace
 {
-}
-PuzzleDay12::~PuzzleDay12() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay12::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay12Impl &impl)
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    const auto result = Day12::CountPaths(pImpl->GetEdges(), false);
+    const auto result = Day12::CountPaths(impl.GetEdges(), false);
     if (result < 0)
     {
         return std::monostate{};
@@ -247,13 +241,9 @@ PuzzleDay12::~PuzzleDay12() = default;
     }
 }
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay12::Part2()
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay12Impl &impl)
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    const auto result = Day12::CountPaths(pImpl->GetEdges(), true);
+    const auto result = Day12::CountPaths(impl.GetEdges(), true);
     if (result < 0)
     {
         return std::monostate{};
@@ -264,4 +254,28 @@ PuzzleDay12::~PuzzleDay12() = default;
     }
 }
 
+} // namespace
+
+PuzzleDay12::PuzzleDay12(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay12Impl>(input))
+{
+}
+PuzzleDay12::~PuzzleDay12() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay12::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay12::Part2()
+{
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<12>(const std::string_view input)
+{
+    PuzzleDay12Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
 } // namespace AOC::Y2021
@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -226,18 +227,12 @@ class PuzzleDay13Impl final
     Day13::TransparentPaper transparentPaper;
 };
 
-PuzzleDay13::PuzzleDay13(const std::string_view input) : pImpl(std::make_unique<PuzzleDay13Impl>(input))
+namespace
 {
-}
-PuzzleDay13::~PuzzleDay13() = default;
 
-[[nodiscard]] IPuzzle::Solution_t PuzzleDay13::Part1()
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay13Impl &impl)
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    const auto result = Day13::CountDotsAfterOneInstruction(pImpl->GetTransParentPaper());
+    const auto result = Day13::CountDotsAfterOneInstruction(impl.GetTransParentPaper());
     if (result < 0)
     {
         return std::monostate{};
@@ -248,13 +243,32 @@ PuzzleDay13::~PuzzleDay13() = default;
     }
 }
 
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay13Impl &impl)
+{
+    return Day13::RestoreCodeByFolding(impl.GetTransParentPaper());
+}
+
+} // namespace
+
+PuzzleDay13::PuzzleDay13(const std::string_view input) : pImpl(std::make_unique<PuzzleDay13Impl>(input))
+{
+}
+PuzzleDay13::~PuzzleDay13() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay13::Part1()
+{
+    return SolvePart1(*pImpl);
+}
+
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay13::Part2()
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    return Day13::RestoreCodeByFolding(pImpl->GetTransParentPaper());
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<13>(const std::string_view input)
+{
+    PuzzleDay13Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
 }
 
 } // namespace AOC::Y2021
@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -237,6 +238,21 @@ class PuzzleDay14Impl final
     Day14::ParserOutput parsed;
 };
 
+namespace
+{
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay14Impl &impl)
+{
+    return GrowPolymer(impl.Get(), 10);
+}
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay14Impl &impl)
+{
+    return GrowPolymer(impl.Get(), 40);
+}
+
+} // namespace
+
 PuzzleDay14::PuzzleDay14(const std::string_view input) : pImpl(std::make_unique<PuzzleDay14Impl>(input))
 {
 }
@@ -244,20 +260,18 @@ PuzzleDay14::~PuzzleDay14() = default;
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay14::Part1()
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    return GrowPolymer(pImpl->Get(), 10);
+    return SolvePart1(*pImpl);
 }
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay14::Part2()
 {
-    if (!pImpl)
-    {
-        return std::monostate{};
-    }
-    return GrowPolymer(pImpl->Get(), 40);
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<14>(const std::string_view input)
+{
+    PuzzleDay14Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
 }
 
 } // namespace AOC::Y2021
@@ -1,5 +1,6 @@
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
@@ -150,7 +151,7 @@ AOC_Y2021_CONSTEXPR IPuzzle::Solution_t SearchLowestRiskPath(const RiskMap &risk
     }
 }
 
-AOC_Y2021_CONSTEXPR IPuzzle::Solution_t ExpandMapAndSearchLowRiskPath(const RiskMap &riskMap)
+AOC_Y2021_CONSTEXPR RiskMap ExpandMap(const RiskMap &riskMap)
 {
     constexpr std::size_t expansionFactor = 5;
     Vector2D expandedMap(riskMap.width() * expansionFactor,
@@ -188,7 +189,77 @@ AOC_Y2021_CONSTEXPR IPuzzle::Solution_t ExpandMapAndSearchLowRiskPath(const Risk
         }
     }
 
-    return SearchLowestRiskPath(expandedMap);
+    return expandedMap;
+}
+
+AOC_Y2021_CONSTEXPR IPuzzle::Solution_t ExpandMapAndSearchLowRiskPath(const RiskMap &riskMap)
+{
+    return SearchLowestRiskPath(ExpandMap(riskMap));
+}
+
+/// Dijkstra with a bucket queue (Dial's algorithm): risk levels are at most 9, so all pending distances fit into 10
+/// buckets indexed by distance modulo 10, and no ordered container is needed.
+AOC_Y2021_CONSTEXPR IPuzzle::Solution_t SearchLowestRiskPathBucketQueue(const RiskMap &riskMap)
+{
+    if (!ValidateInput(riskMap))
+    {
+        return std::monostate{};
+    }
+    constexpr std::size_t numBuckets = 10u;
+    const std::size_t width = riskMap.width();
+    const std::size_t height = riskMap.height();
+    const std::size_t destinationIndex = riskMap.size() - 1u;
+    std::array<std::vector<std::size_t>, numBuckets> buckets{};
+    std::vector<std::int64_t> distancesFromStart(riskMap.size(), INT64_MAX);
+    distancesFromStart[0] = 0;
+    buckets[0].push_back(0);
+    std::size_t numPending = 1u;
+    for (std::int64_t distance = 0; numPending != 0u; ++distance)
+    {
+        auto &bucket = buckets[static_cast<std::size_t>(distance) % numBuckets];
+        while (!bucket.empty())
+        {
+            const auto index = bucket.back();
+            bucket.pop_back();
+            --numPending;
+            if (distancesFromStart[index] != distance)
+            {
+                continue; // outdated entry, the vertex has been reached on a shorter path meanwhile
+            }
+            if (index == destinationIndex)
+            {
+                return distance;
+            }
+            const std::size_t x = index % width;
+            const std::size_t y = index / width;
+            const auto relax = [&](const std::size_t neighborIndex) {
+                const auto neighborDistance = distance + riskMap[neighborIndex];
+                if (neighborDistance < distancesFromStart[neighborIndex])
+                {
+                    distancesFromStart[neighborIndex] = neighborDistance;
+                    buckets[static_cast<std::size_t>(neighborDistance) % numBuckets].push_back(neighborIndex);
+                    ++numPending;
+                }
+            };
+            if (x != 0u)
+            {
+                relax(index - 1u);
+            }
+            if ((x + 1u) != width)
+            {
+                relax(index + 1u);
+            }
+            if (y != 0u)
+            {
+                relax(index - width);
+            }
+            if ((y + 1u) != height)
+            {
+                relax(index + width);
+            }
+        }
+    }
+    return std::monostate{};
 }
 
 } // namespace
@@ -207,10 +278,39 @@ class PuzzleDay15Impl final
     Day15::RiskMap riskMap;
 };
 
+class PuzzleDay15OptimizedImpl final
+{
+
+  public:
+    explicit AOC_Y2021_CONSTEXPR PuzzleDay15OptimizedImpl(std::string_view input) : riskMap(ParseToVector2D(input))
+    {
+    }
+
+  public:
+    Day15::RiskMap riskMap;
+};
+
 #if defined(AOC_Y2021_PUZZLE_CLASS_DECLARATION)
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(15)
 
+namespace
+{
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart1(PuzzleDay15Impl &impl)
+{
+    const auto result = Day15::SearchLowestRiskPath(impl.riskMap);
+    return result;
+}
+
+[[nodiscard]] IPuzzle::Solution_t SolvePart2(PuzzleDay15Impl &impl)
+{
+    const auto result = Day15::ExpandMapAndSearchLowRiskPath(impl.riskMap);
+    return result;
+}
+
+} // namespace
+
 PuzzleDay15::PuzzleDay15(const std::string_view input) : pImpl(std::make_unique<PuzzleDay15Impl>(input))
 {
 }
@@ -218,14 +318,36 @@ PuzzleDay15::~PuzzleDay15() = default;
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay15::Part1()
 {
-    const auto result = Day15::SearchLowestRiskPath(pImpl->riskMap);
-    return result;
+    return SolvePart1(*pImpl);
 }
 
 [[nodiscard]] IPuzzle::Solution_t PuzzleDay15::Part2()
 {
-    const auto result = Day15::ExpandMapAndSearchLowRiskPath(pImpl->riskMap);
-    return result;
+    return SolvePart2(*pImpl);
+}
+
+template <> PuzzleSolution Solve<15>(const std::string_view input)
+{
+    PuzzleDay15Impl impl{input};
+    return {SolvePart1(impl), SolvePart2(impl)};
+}
+
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(15, Optimized)
+
+PuzzleDay15Optimized::PuzzleDay15Optimized(const std::string_view input)
+    : pImpl(std::make_unique<PuzzleDay15OptimizedImpl>(input))
+{
+}
+PuzzleDay15Optimized::~PuzzleDay15Optimized() = default;
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay15Optimized::Part1()
+{
+    return Day15::SearchLowestRiskPathBucketQueue(pImpl->riskMap);
+}
+
+[[nodiscard]] IPuzzle::Solution_t PuzzleDay15Optimized::Part2()
+{
+    return Day15::SearchLowestRiskPathBucketQueue(Day15::ExpandMap(pImpl->riskMap));
 }
 
 #endif // defined(AOC_Y2021_PUZZLE_CLASS_DECLARATION)
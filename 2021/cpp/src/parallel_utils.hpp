@@ -0,0 +1,52 @@
+#if !defined(AOC_Y2021_PARALLEL_UTILS_HPP)
+#define AOC_Y2021_PARALLEL_UTILS_HPP (1)
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace AOC::Y2021
+{
+
+/// Calls fnTask(taskIndex) for every task index in [0, numTasks). The tasks are distributed dynamically over up to
+/// std::thread::hardware_concurrency() threads, including the calling thread. Returns when all tasks are done.
+template <typename Fn> void ParallelFor(const std::size_t numTasks, Fn &&fnTask)
+{
+    const std::size_t numThreads =
+        std::min<std::size_t>(numTasks, std::max<std::size_t>(1u, std::thread::hardware_concurrency()));
+    std::atomic<std::size_t> nextTask{0u};
+    const auto worker = [&nextTask, &fnTask, numTasks]() {
+        for (auto task = nextTask++; task < numTasks; task = nextTask++)
+        {
+            fnTask(task);
+        }
+    };
+    std::vector<std::jthread> threads;
+    for (std::size_t i = 1u; i < numThreads; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+}
+
+/// Splits text into chunks of at least minChunkSize bytes. Every chunk but the last one ends with a '\n', so no line is
+/// cut into two chunks.
+inline std::vector<std::string_view> SplitAtLineBoundaries(std::string_view input, const std::size_t minChunkSize)
+{
+    std::vector<std::string_view> chunks;
+    while (!input.empty())
+    {
+        const auto lf = (input.size() > minChunkSize) ? input.find('\n', minChunkSize - 1u) : input.npos;
+        const auto chunkSize = (lf == input.npos) ? input.size() : (lf + 1u);
+        chunks.push_back(input.substr(0, chunkSize));
+        input.remove_prefix(chunkSize);
+    }
+    return chunks;
+}
+
+} // namespace AOC::Y2021
+
+#endif // !defined(AOC_Y2021_PARALLEL_UTILS_HPP)
@@ -1,18 +1,24 @@
 #if !defined(AOC_Y2021_PUZZLE_COMMON_HPP)
 #define AOC_Y2021_PUZZLE_COMMON_HPP (1)
 
-#define AOC_Y2021_PUZZLE_CLASS_DECLARATION(day)                                                                        \
-    class PuzzleDay##day##Impl;                                                                                        \
-    class PuzzleDay##day final : public IPuzzle                                                                        \
+#define AOC_Y2021_PUZZLE_NAMED_CLASS_DECLARATION(className)                                                            \
+    class className##Impl;                                                                                             \
+    class className final : public IPuzzle                                                                             \
     {                                                                                                                  \
       public:                                                                                                          \
-        explicit PuzzleDay##day(std::string_view input);                                                               \
+        explicit className(std::string_view input);                                                                    \
         [[nodiscard]] Solution_t Part1() override;                                                                     \
         [[nodiscard]] Solution_t Part2() override;                                                                     \
-        ~PuzzleDay##day() override;                                                                                    \
+        ~className() override;                                                                                         \
                                                                                                                        \
       private:                                                                                                         \
-        std::unique_ptr<PuzzleDay##day##Impl> pImpl;                                                                   \
+        std::unique_ptr<className##Impl> pImpl;                                                                        \
     };
 
+#define AOC_Y2021_PUZZLE_CLASS_DECLARATION(day) AOC_Y2021_PUZZLE_NAMED_CLASS_DECLARATION(PuzzleDay##day)
+
+/// declares the additional solver engine PuzzleDay<day><engine> (e.g. PuzzleDay15Optimized) of a day
+#define AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(day, engine)                                                         \
+    AOC_Y2021_PUZZLE_NAMED_CLASS_DECLARATION(PuzzleDay##day##engine)
+
 #endif // !defined(AOC_Y2021_PUZZLE_COMMON_HPP)
@@ -1,7 +1,11 @@
 #include "puzzle_factory.hpp"
 #include "puzzle_common.hpp"
+#include "puzzle_solve.hpp"
 #include "utils.hpp"
 
+#include <array>
+#include <utility>
+
 #define AOC_Y2021_SUPPORTED_PUZZLES_LIST(X_)                                                                           \
     X_(01)                                                                                                             \
     X_(02)                                                                                                             \
@@ -19,10 +23,37 @@
     X_(14)                                                                                                             \
     X_(15)
 
+/// additional solver engines per day, X_(day, engine)
+#define AOC_Y2021_SUPPORTED_ENGINES_LIST(X_)                                                                           \
+    X_(01, Optimized)                                                                                                  \
+    X_(01, Parallel)                                                                                                   \
+    X_(02, Parallel)                                                                                                   \
+    X_(03, Optimized)                                                                                                  \
+    X_(04, Optimized)                                                                                                  \
+    X_(04, Parallel)                                                                                                   \
+    X_(05, Optimized)                                                                                                  \
+    X_(05, Parallel)                                                                                                   \
+    X_(06, Optimized)                                                                                                  \
+    X_(07, Optimized)                                                                                                  \
+    X_(08, Optimized)                                                                                                  \
+    X_(15, Optimized)
+
 namespace AOC::Y2021
 {
 
 AOC_Y2021_SUPPORTED_PUZZLES_LIST(AOC_Y2021_PUZZLE_CLASS_DECLARATION)
+AOC_Y2021_SUPPORTED_ENGINES_LIST(AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION)
+
+namespace
+{
+
+constexpr std::array engineNames = {
+    std::make_pair(PuzzleEngine::Reference, std::string_view{"reference"}),
+    std::make_pair(PuzzleEngine::Optimized, std::string_view{"optimized"}),
+    std::make_pair(PuzzleEngine::Parallel, std::string_view{"parallel"}),
+};
+
+} // namespace
 
 std::unique_ptr<IPuzzle> PuzzleFactory::CreatePuzzle(const std::uint8_t game, const std::string_view input)
 {
@@ -42,4 +73,137 @@ std::unique_ptr<IPuzzle> PuzzleFactory::CreatePuzzle(const std::uint8_t game, co
     }
 }
 
+PuzzleSolution Solve(const std::uint8_t day, const std::string_view input)
+{
+    switch (day)
+    {
+
+    default:
+        return {};
+
+#define AOC_Y2021_PUZZLE_SOLVE_CASE(day_)                                                                              \
+    case ParseNumber<std::uint8_t>(#day_):                                                                             \
+        return Solve<ParseNumber<std::uint8_t>(#day_)>(input);
+
+        AOC_Y2021_SUPPORTED_PUZZLES_LIST(AOC_Y2021_PUZZLE_SOLVE_CASE)
+
+#undef AOC_Y2021_PUZZLE_SOLVE_CASE
+    }
+}
+
+std::unique_ptr<IPuzzle> PuzzleFactory::CreatePuzzle(const std::uint8_t game, const std::string_view input,
+                                                     const PuzzleEngine engine)
+{
+    if (engine == PuzzleEngine::Reference)
+    {
+        return CreatePuzzle(game, input);
+    }
+
+#define AOC_Y2021_PUZZLE_ENGINE_CASE(day, engine_)                                                                     \
+    if ((game == ParseNumber<std::uint8_t>(#day)) && (engine == PuzzleEngine::engine_))                                \
+    {                                                                                                                  \
+        return std::make_unique<PuzzleDay##day##engine_>(input);                                                       \
+    }
+
+    AOC_Y2021_SUPPORTED_ENGINES_LIST(AOC_Y2021_PUZZLE_ENGINE_CASE)
+
+#undef AOC_Y2021_PUZZLE_ENGINE_CASE
+
+    return nullptr;
+}
+
+std::vector<PuzzleEngine> PuzzleFactory::GetEngines(const std::uint8_t game)
+{
+    std::vector<PuzzleEngine> engines;
+
+#define AOC_Y2021_PUZZLE_REFERENCE_ENGINE(day)                                                                         \
+    if (game == ParseNumber<std::uint8_t>(#day))                                                                       \
+    {                                                                                                                  \
+        engines.push_back(PuzzleEngine::Reference);                                                                    \
+    }
+#define AOC_Y2021_PUZZLE_ENGINE(day, engine_)                                                                          \
+    if (game == ParseNumber<std::uint8_t>(#day))                                                                       \
+    {                                                                                                                  \
+        engines.push_back(PuzzleEngine::engine_);                                                                      \
+    }
+
+    AOC_Y2021_SUPPORTED_PUZZLES_LIST(AOC_Y2021_PUZZLE_REFERENCE_ENGINE)
+    AOC_Y2021_SUPPORTED_ENGINES_LIST(AOC_Y2021_PUZZLE_ENGINE)
+
+#undef AOC_Y2021_PUZZLE_ENGINE
+#undef AOC_Y2021_PUZZLE_REFERENCE_ENGINE
+
+    return engines;
+}
+
+std::vector<PuzzleFactory::EngineMismatch> PuzzleFactory::VerifyEngines(const std::uint8_t game,
+                                                                        const std::string_view input)
+{
+    std::vector<EngineMismatch> mismatches;
+    auto pReference = CreatePuzzle(game, input);
+    if (pReference == nullptr)
+    {
+        return mismatches;
+    }
+    const auto expectedPart1 = pReference->Part1();
+    const auto expectedPart2 = pReference->Part2();
+    for (const auto engine : GetEngines(game))
+    {
+        if (engine == PuzzleEngine::Reference)
+        {
+            continue;
+        }
+        auto pPuzzle = CreatePuzzle(game, input, engine);
+        const auto engineMismatches = CompareSolutions(engine, *pPuzzle, expectedPart1, expectedPart2);
+        mismatches.insert(mismatches.end(), engineMismatches.begin(), engineMismatches.end());
+    }
+    return mismatches;
+}
+
+std::vector<PuzzleFactory::EngineMismatch> PuzzleFactory::CompareSolutions(const PuzzleEngine engine, IPuzzle &puzzle,
+                                                                           const IPuzzle::Solution_t &expectedPart1,
+                                                                           const IPuzzle::Solution_t &expectedPart2)
+{
+    std::vector<EngineMismatch> mismatches;
+    const std::array expected = {expectedPart1, expectedPart2};
+    const std::array actual = {puzzle.Part1(), puzzle.Part2()};
+    for (std::uint8_t part = 1u; part <= actual.size(); ++part)
+    {
+        if (actual[part - 1u] != expected[part - 1u])
+        {
+            mismatches.push_back({
+                .engine = engine,
+                .part = part,
+                .expected = expected[part - 1u],
+                .actual = actual[part - 1u],
+            });
+        }
+    }
+    return mismatches;
+}
+
+std::string_view PuzzleFactory::GetEngineName(const PuzzleEngine engine)
+{
+    for (const auto &[e, name] : engineNames)
+    {
+        if (e == engine)
+        {
+            return name;
+        }
+    }
+    return {};
+}
+
+std::optional<PuzzleEngine> PuzzleFactory::ParseEngineName(const std::string_view name)
+{
+    for (const auto &[engine, engineName] : engineNames)
+    {
+        if (engineName == name)
+        {
+            return engine;
+        }
+    }
+    return std::nullopt;
+}
+
 } // namespace AOC::Y2021
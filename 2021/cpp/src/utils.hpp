@@ -6,8 +6,12 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace AOC::Y2021
@@ -121,6 +125,203 @@ template <typename T, char DELIMITER> AOC_Y2021_CONSTEXPR std::vector<T> ParseTo
     return ret;
 }
 
+/// Decimal representation of an unsigned number of arbitrary width, given as 32 bit limbs with the least significant
+/// limb first
+inline std::string ToDecimalString(std::vector<std::uint32_t> limbs)
+{
+    while (!limbs.empty() && (limbs.back() == 0u))
+    {
+        limbs.pop_back();
+    }
+    std::vector<std::uint32_t> decimalChunks; // base 10^9, least significant first
+    constexpr std::uint32_t chunkBase = 1'000'000'000u;
+    while (!limbs.empty())
+    {
+        std::uint64_t remainder = 0u;
+        for (auto limb = limbs.rbegin(); limb != limbs.rend(); ++limb)
+        {
+            const std::uint64_t dividend = (remainder << 32u) | *limb;
+            *limb = static_cast<std::uint32_t>(dividend / chunkBase);
+            remainder = dividend % chunkBase;
+        }
+        decimalChunks.push_back(static_cast<std::uint32_t>(remainder));
+        while (!limbs.empty() && (limbs.back() == 0u))
+        {
+            limbs.pop_back();
+        }
+    }
+    if (decimalChunks.empty())
+    {
+        return "0";
+    }
+    std::string decimal = std::to_string(decimalChunks.back());
+    for (auto chunk = decimalChunks.rbegin() + 1; chunk != decimalChunks.rend(); ++chunk)
+    {
+        const auto digits = std::to_string(*chunk);
+        decimal.append(9u - digits.size(), '0');
+        decimal += digits;
+    }
+    return decimal;
+}
+
+/// Schoolbook product of two unsigned numbers given as 32 bit limbs with the least significant limb first. The product
+/// has no leading zero limbs.
+inline std::vector<std::uint32_t> MultiplyLimbs(const std::vector<std::uint32_t> &lhs,
+                                                const std::vector<std::uint32_t> &rhs)
+{
+    std::vector<std::uint32_t> product(lhs.size() + rhs.size(), 0u);
+    for (std::size_t i = 0; i != lhs.size(); ++i)
+    {
+        std::uint64_t carry = 0u;
+        for (std::size_t j = 0; j != rhs.size(); ++j)
+        {
+            carry += product[i + j] + (std::uint64_t{lhs[i]} * rhs[j]);
+            product[i + j] = static_cast<std::uint32_t>(carry);
+            carry >>= 32u;
+        }
+        product[i + rhs.size()] = static_cast<std::uint32_t>(carry);
+    }
+    while (!product.empty() && (product.back() == 0u))
+    {
+        product.pop_back();
+    }
+    return product;
+}
+
+/// full 128 bit product of two 64 bit numbers as {high, low}
+constexpr std::pair<std::uint64_t, std::uint64_t> MultiplyFull(const std::uint64_t lhs, const std::uint64_t rhs)
+{
+    constexpr std::uint64_t lowMask = 0xFFFF'FFFFu;
+    const auto lowLow = (lhs & lowMask) * (rhs & lowMask);
+    const auto lowHigh = (lhs & lowMask) * (rhs >> 32u);
+    const auto highLow = (lhs >> 32u) * (rhs & lowMask);
+    const auto highHigh = (lhs >> 32u) * (rhs >> 32u);
+    const auto middle = (lowLow >> 32u) + (lowHigh & lowMask) + (highLow & lowMask);
+    return {highHigh + (lowHigh >> 32u) + (highLow >> 32u) + (middle >> 32u), (middle << 32u) | (lowLow & lowMask)};
+}
+
+/// Non-negative 128 bit integer that remembers whether an operation leading to it overflowed
+class CheckedUInt128 final
+{
+  public:
+    constexpr CheckedUInt128() = default;
+
+    constexpr explicit CheckedUInt128(const std::int64_t value)
+        : low(static_cast<std::uint64_t>(value)), bOverflow(value < 0)
+    {
+    }
+
+    static constexpr CheckedUInt128 FromUInt64(const std::uint64_t value)
+    {
+        CheckedUInt128 number;
+        number.low = value;
+        return number;
+    }
+
+    friend constexpr CheckedUInt128 operator+(const CheckedUInt128 &lhs, const CheckedUInt128 &rhs)
+    {
+        CheckedUInt128 sum;
+        sum.low = lhs.low + rhs.low;
+        const auto highWithoutCarry = lhs.high + rhs.high;
+        sum.high = highWithoutCarry + ((sum.low < lhs.low) ? 1u : 0u);
+        sum.bOverflow =
+            lhs.bOverflow || rhs.bOverflow || (highWithoutCarry < lhs.high) || (sum.high < highWithoutCarry);
+        return sum;
+    }
+
+    /// the difference, flagged as overflow if it would be negative
+    friend constexpr CheckedUInt128 operator-(const CheckedUInt128 &lhs, const CheckedUInt128 &rhs)
+    {
+        CheckedUInt128 difference;
+        difference.low = lhs.low - rhs.low;
+        const auto borrow = (lhs.low < rhs.low) ? 1u : 0u;
+        difference.high = lhs.high - rhs.high - borrow;
+        difference.bOverflow = lhs.bOverflow || rhs.bOverflow || (lhs.high < rhs.high) ||
+                               ((lhs.high == rhs.high) && (borrow != 0u));
+        return difference;
+    }
+
+    friend constexpr CheckedUInt128 operator*(const CheckedUInt128 &lhs, const CheckedUInt128 &rhs)
+    {
+        CheckedUInt128 product;
+        const auto [lowHigh, lowLow] = MultiplyFull(lhs.low, rhs.low);
+        const auto [crossHigh1, crossLow1] = MultiplyFull(lhs.high, rhs.low);
+        const auto [crossHigh2, crossLow2] = MultiplyFull(lhs.low, rhs.high);
+        product.low = lowLow;
+        product.high = lowHigh + crossLow1;
+        bool bOverflow = (product.high < lowHigh);
+        product.high += crossLow2;
+        bOverflow = bOverflow || (product.high < crossLow2);
+        product.bOverflow = bOverflow || lhs.bOverflow || rhs.bOverflow || ((lhs.high != 0u) && (rhs.high != 0u)) ||
+                            (crossHigh1 != 0u) || (crossHigh2 != 0u);
+        return product;
+    }
+
+    /// the value divided by 2^shift for shifts below 64
+    friend constexpr CheckedUInt128 operator>>(const CheckedUInt128 &lhs, const unsigned shift)
+    {
+        CheckedUInt128 quotient = lhs;
+        if (shift != 0u)
+        {
+            quotient.low = (lhs.low >> shift) | (lhs.high << (64u - shift));
+            quotient.high = lhs.high >> shift;
+        }
+        return quotient;
+    }
+
+    /// overflowed values compare greater than all valid values, so that they never win a search for the minimum
+    friend constexpr bool operator<(const CheckedUInt128 &lhs, const CheckedUInt128 &rhs)
+    {
+        if (lhs.bOverflow || rhs.bOverflow)
+        {
+            return !lhs.bOverflow;
+        }
+        return (lhs.high < rhs.high) || ((lhs.high == rhs.high) && (lhs.low < rhs.low));
+    }
+
+    [[nodiscard]] constexpr bool IsOverflow() const
+    {
+        return bOverflow;
+    }
+
+    /// the value if it fits into 64 bit and no operation leading to it overflowed
+    [[nodiscard]] constexpr std::optional<std::uint64_t> GetUInt64() const
+    {
+        if (bOverflow || (high != 0u))
+        {
+            return std::nullopt;
+        }
+        return low;
+    }
+
+    /// decimal representation, std::nullopt if an operation leading to the value overflowed
+    [[nodiscard]] std::optional<std::string> Get() const
+    {
+        if (bOverflow)
+        {
+            return std::nullopt;
+        }
+        return ToDecimalString({static_cast<std::uint32_t>(low), static_cast<std::uint32_t>(low >> 32u),
+                                static_cast<std::uint32_t>(high), static_cast<std::uint32_t>(high >> 32u)});
+    }
+
+  private:
+    std::uint64_t high{0};
+    std::uint64_t low{0};
+    bool bOverflow{false};
+};
+
+static_assert(MultiplyFull(0xFFFF'FFFF'FFFF'FFFFu, 0xFFFF'FFFF'FFFF'FFFFu) ==
+              std::pair<std::uint64_t, std::uint64_t>{0xFFFF'FFFF'FFFF'FFFEu, 1u});
+static_assert(!(CheckedUInt128::FromUInt64(0xFFFF'FFFF'FFFF'FFFFu) * CheckedUInt128{2}).GetUInt64().has_value());
+static_assert(CheckedUInt128{-1}.IsOverflow());
+static_assert((CheckedUInt128{1} - CheckedUInt128{2}).IsOverflow());
+static_assert(CheckedUInt128{1} < (CheckedUInt128{1} - CheckedUInt128{2}));
+static_assert(!((CheckedUInt128{1} - CheckedUInt128{2}) < CheckedUInt128{1}));
+static_assert(!(CheckedUInt128{-1} < CheckedUInt128{-2}));
+static_assert(((CheckedUInt128{1} * CheckedUInt128{std::numeric_limits<std::int64_t>::max()} * CheckedUInt128{4}) >> 2u)
+                  .GetUInt64() == std::uint64_t{std::numeric_limits<std::int64_t>::max()});
+
 template <typename T, std::size_t N> consteval auto Vector2Array(const std::vector<T> &vec)
 {
     std::array<T, N> ret{};
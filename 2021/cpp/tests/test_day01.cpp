@@ -1,16 +1,27 @@
 
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
+#include "sonar_monitor.hpp"
+#include "sonar_sweep.hpp"
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <numeric>
+#include <random>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(01)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(01, Optimized)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(01, Parallel)
 
 namespace
 {
@@ -38,5 +49,115 @@ TEST_F(Day01Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 5);
 }
 
+class Day01OptimizedTest : public Day01Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay01Optimized>(exampleInput);
+    }
+};
+
+TEST_F(Day01OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 7);
+}
+
+TEST_F(Day01OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 5);
+}
+
+class Day01ParallelTest : public Day01Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay01Parallel>(exampleInput);
+    }
+};
+
+TEST_F(Day01ParallelTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 7);
+}
+
+TEST_F(Day01ParallelTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 5);
+}
+
+TEST_F(Day01ParallelTest, ChunkBoundaries)
+{
+    // large enough to be split into several chunks, with windows straddling each chunk boundary
+    std::mt19937 rng;
+    std::uniform_int_distribution<int> depthChange(-3, 4);
+    std::string input;
+    for (int depth = 100; input.size() < 1'000'000u; depth += depthChange(rng))
+    {
+        input += std::to_string(depth);
+        input += '\n';
+    }
+    PuzzleDay01 reference{input};
+    pPuzzle = std::make_unique<PuzzleDay01Parallel>(input);
+    ASSERT_EQ(pPuzzle->Part1(), reference.Part1());
+    ASSERT_EQ(pPuzzle->Part2(), reference.Part2());
+}
+
+TEST(SonarMonitorTest, PushSamplesAndBatches)
+{
+    constexpr std::array<std::size_t, 4> windowSizes = {1u, 2u, 3u, 9u};
+    constexpr std::array depths = {199, 200, 208, 210, 200, 207, 240, 269, 260, 263};
+    SonarMonitor monitor{windowSizes};
+    monitor.Push(depths[0]);
+    monitor.Push(depths[1]);
+    ASSERT_EQ(monitor.GetIncreases(1u), 1);
+    ASSERT_EQ(monitor.GetIncreases(3u), 0);
+    monitor.Push(std::span(depths).subspan(2u));
+    ASSERT_EQ(monitor.GetNumSamples(), depths.size());
+    ASSERT_EQ(monitor.GetIncreases(1u), 7);
+    ASSERT_EQ(monitor.GetIncreases(2u), 5);
+    ASSERT_EQ(monitor.GetIncreases(3u), 5);
+    ASSERT_EQ(monitor.GetIncreases(9u), 1);
+    ASSERT_FALSE(monitor.GetIncreases(4u).has_value());
+}
+
+TEST(SonarSweepTest, CountDepthIncreasesOfAnyWindowSize)
+{
+    constexpr std::array depths = {199, 200, 208, 210, 200, 207, 240, 269, 260, 263};
+    ASSERT_EQ(CountDepthIncreases(depths, 1u), 7);
+    ASSERT_EQ(CountDepthIncreases(depths, 2u), 5);
+    ASSERT_EQ(CountDepthIncreases(depths, 3u), 5);
+    ASSERT_EQ(CountDepthIncreases(depths, 5u), 5);
+    ASSERT_EQ(CountDepthIncreases(depths, 9u), 1);
+    ASSERT_EQ(CountDepthIncreases(depths, depths.size()), 0);
+    ASSERT_EQ(CountDepthIncreases(depths, depths.size() + 1u), 0);
+    ASSERT_EQ(CountDepthIncreases(depths, 0u), 0);
+    ASSERT_EQ(CountDepthIncreases({}, 1u), 0);
+}
+
+TEST(SonarSweepTest, CountDepthIncreasesMatchesWindowSums)
+{
+    std::mt19937 rng;
+    std::uniform_int_distribution<int> depth(0, 10'000);
+    std::vector<int> depths(5000u);
+    for (auto &d : depths)
+    {
+        d = depth(rng);
+    }
+    for (const std::size_t windowSize : {1u, 4u, 7u, 64u, 4999u})
+    {
+        std::int64_t increases = 0;
+        for (std::size_t start = 1u; (start + windowSize) <= depths.size(); ++start)
+        {
+            const auto window = depths.begin() + static_cast<std::ptrdiff_t>(start);
+            const auto windowEnd = window + static_cast<std::ptrdiff_t>(windowSize);
+            increases += static_cast<std::int64_t>(std::accumulate(window, windowEnd, 0) >
+                                                   std::accumulate(window - 1, windowEnd - 1, 0));
+        }
+        ASSERT_EQ(CountDepthIncreases(depths, windowSize), increases);
+    }
+}
+
 } // namespace
 } // namespace AOC::Y2021
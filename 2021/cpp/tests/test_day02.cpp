@@ -5,12 +5,15 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <random>
+#include <string>
 #include <string_view>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(02)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(02, Parallel)
 
 namespace
 {
@@ -38,5 +41,59 @@ TEST_F(Day02Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 900);
 }
 
+TEST_F(Day02Test, NoIntOverflow)
+{
+    pPuzzle = std::make_unique<PuzzleDay02>("down 100000\nforward 3000000\nforward 3000000\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 600'000'000'000);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 3'600'000'000'000'000'000);
+}
+
+class Day02ParallelTest : public Day02Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay02Parallel>(exampleInput);
+    }
+};
+
+TEST_F(Day02ParallelTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 150);
+}
+
+TEST_F(Day02ParallelTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 900);
+}
+
+TEST_F(Day02ParallelTest, ChunkedCommands)
+{
+    // large enough to be split into several chunks
+    std::mt19937 rng;
+    std::uniform_int_distribution<int> command(0, 2);
+    std::uniform_int_distribution<int> value(1, 9);
+    std::string input;
+    while (input.size() < 1'000'000u)
+    {
+        constexpr std::string_view commands[] = {"forward ", "down ", "up "};
+        input += commands[command(rng)];
+        input += std::to_string(value(rng));
+        input += "\r\n";
+    }
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay02>(input);
+    pPuzzle = std::make_unique<PuzzleDay02Parallel>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+
+    // commands after an invalid line are ignored
+    const auto split = input.find('\n', input.size() / 2u);
+    const std::string inputWithEmptyLine = input.substr(0u, split) + '\n' + input.substr(split);
+    pReference = std::make_unique<PuzzleDay02>(inputWithEmptyLine);
+    pPuzzle = std::make_unique<PuzzleDay02Parallel>(inputWithEmptyLine);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+}
+
 } // namespace
 } // namespace AOC::Y2021
@@ -4,13 +4,19 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <random>
+#include <string>
 #include <string_view>
+#include <utility>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(03)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(03, Optimized)
 
 namespace
 {
@@ -39,5 +45,83 @@ TEST_F(Day03Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 230);
 }
 
+TEST_F(Day03Test, Part1WideReport)
+{
+    PuzzleDay03 puzzle32("11111111111111110000000000000000\n11111111111111110000000000000000\n"
+                         "00000000000000000000000000000000\n");
+    ASSERT_EQ(std::get<std::int64_t>(puzzle32.Part1()), 0xFFFF0000LL * 0xFFFFLL);
+    PuzzleDay03 puzzle33("111111111111111110000000000000000\n111111111111111110000000000000000\n"
+                         "000000000000000000000000000000000\n");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(puzzle33.Part1()));
+}
+
+TEST_F(Day03Test, Part2WideReport)
+{
+    PuzzleDay03 puzzle("11111111111111111111\n01111111111111111111\n10000000000000000000\n");
+    ASSERT_EQ(std::get<std::int64_t>(puzzle.Part2()), 1048575LL * 524287LL);
+}
+
+class Day03OptimizedTest : public Day03Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay03Optimized>(exampleInput);
+    }
+};
+
+TEST_F(Day03OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 198);
+}
+
+TEST_F(Day03OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 230);
+}
+
+TEST_F(Day03OptimizedTest, WideReport)
+{
+    const auto makeReport = [](const std::size_t halfWidth) {
+        const auto mostCommon = std::string(halfWidth, '1') + std::string(halfWidth, '0') + '\n';
+        return mostCommon + mostCommon + std::string(2u * halfWidth, '0') + '\n';
+    };
+    PuzzleDay03Optimized puzzle40(makeReport(20u));
+    ASSERT_EQ(std::get<std::int64_t>(puzzle40.Part1()), 1152919305584640000);
+    PuzzleDay03Optimized puzzle70(makeReport(35u));
+    ASSERT_EQ(std::get<std::string>(puzzle70.Part1()), "40564819204942157606494039703552");
+}
+
+TEST_F(Day03OptimizedTest, Part2WideReport)
+{
+    const auto input = std::string(70u, '1') + "\n0" + std::string(69u, '1') + "\n1" + std::string(69u, '0') + '\n';
+    PuzzleDay03Optimized puzzle(input);
+    ASSERT_EQ(std::get<std::string>(puzzle.Part2()), "696898287454081973171220308589185180106753");
+    PuzzleDay03Optimized puzzle20("11111111111111111111\n01111111111111111111\n10000000000000000000\n");
+    ASSERT_EQ(std::get<std::int64_t>(puzzle20.Part2()), 1048575LL * 524287LL);
+}
+
+TEST_F(Day03OptimizedTest, RandomReports)
+{
+    for (const auto &[width, numRows] : {std::pair<std::size_t, std::size_t>{5u, 17u}, {12u, 1000u}, {16u, 70'000u}})
+    {
+        std::mt19937 rng{static_cast<unsigned>(width)};
+        std::bernoulli_distribution bit(0.45);
+        std::string input;
+        for (std::size_t row = 0; row != numRows; ++row)
+        {
+            for (std::size_t column = 0; column != width; ++column)
+            {
+                input += bit(rng) ? '1' : '0';
+            }
+            input += '\n';
+        }
+        std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay03>(input);
+        pPuzzle = std::make_unique<PuzzleDay03Optimized>(input);
+        ASSERT_EQ(pPuzzle->Part1(), pReference->Part1()) << width;
+        ASSERT_EQ(pPuzzle->Part2(), pReference->Part2()) << width;
+    }
+}
+
 } // namespace
 } // namespace AOC::Y2021
@@ -4,17 +4,71 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <numeric>
+#include <random>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(04)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(04, Optimized)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(04, Parallel)
 
 namespace
 {
 
+/// Random game with all numbers drawn. Boards may hold a number more than once, several boards may win on the same
+/// draw.
+std::string MakeTournament(const int numBoards, const int boardSize = 5, const int numNumbers = 100,
+                           const std::uint32_t valueStep = 1u)
+{
+    std::mt19937 rng;
+    std::vector<std::uint32_t> draws(static_cast<std::size_t>(numNumbers));
+    std::iota(draws.begin(), draws.end(), 0u);
+    std::ranges::shuffle(draws, rng);
+    std::string input;
+    for (const auto draw : draws)
+    {
+        input += std::to_string(draw * valueStep) + ',';
+    }
+    input.back() = '\n';
+    std::uniform_int_distribution<std::uint32_t> number(0u, static_cast<std::uint32_t>(numNumbers - 1));
+    for (int board = 0; board != numBoards; ++board)
+    {
+        input += '\n';
+        for (int cell = 0; cell != (boardSize * boardSize); ++cell)
+        {
+            input += std::to_string(number(rng) * valueStep) + (((cell % boardSize) == (boardSize - 1)) ? '\n' : ' ');
+        }
+    }
+    return input;
+}
+
+/// two 5x5 boards of 32 bit numbers whose scores do not fit into 64 bit
+constexpr std::string_view hugeScoresInput =
+    "4000000000,4000000001,4000000002,4000000003,4000000004,4000000005\n"
+    "\n"
+    "4000000000 4000000001 4000000002 4000000003 4000000004\n"
+    "4294967295 4294967295 4294967295 4294967295 4294967295\n"
+    "4294967295 4294967295 4294967295 4294967295 4294967295\n"
+    "4294967295 4294967295 4294967295 4294967295 4294967295\n"
+    "4294967295 4294967295 4294967295 4294967295 4294967295\n"
+    "\n"
+    "4000000001 4294967294 4294967294 4294967294 4294967294\n"
+    "4000000002 4294967294 4294967294 4294967294 4294967294\n"
+    "4000000003 4294967294 4294967294 4294967294 4294967294\n"
+    "4000000004 4294967294 4294967294 4294967294 4294967294\n"
+    "4000000005 4294967294 4294967294 4294967294 4294967294\n";
+constexpr std::string_view hugeScorePart1 = "343597383943597383600";
+constexpr std::string_view hugeScorePart2 = "343597383949496729400";
+
 class Day04Test : public ::testing::Test
 {
   protected:
@@ -42,5 +96,103 @@ TEST_F(Day04Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 1924);
 }
 
+TEST_F(Day04Test, GeneralizedBoards)
+{
+    pPuzzle = std::make_unique<PuzzleDay04>("1000,2000,3000,500\n\n1000 2000 3000\n4 5 6\n7 8 9\n\n"
+                                            "500 1 1\n1000 1 1\n2000 1 1\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 117000);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 3000);
+}
+
+TEST_F(Day04Test, HugeScores)
+{
+    pPuzzle = std::make_unique<PuzzleDay04>(hugeScoresInput);
+    ASSERT_EQ(std::get<std::string>(pPuzzle->Part1()), hugeScorePart1);
+    ASSERT_EQ(std::get<std::string>(pPuzzle->Part2()), hugeScorePart2);
+}
+
+class Day04OptimizedTest : public Day04Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay04Optimized>(exampleInput);
+    }
+};
+
+TEST_F(Day04OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 4512);
+}
+
+TEST_F(Day04OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 1924);
+}
+
+TEST_F(Day04OptimizedTest, Tournament)
+{
+    const auto input = MakeTournament(2000);
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay04>(input);
+    pPuzzle = std::make_unique<PuzzleDay04Optimized>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+}
+
+TEST_F(Day04OptimizedTest, LargeBoards)
+{
+    const auto input = MakeTournament(4, 64, 4096, 1'000'003u);
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay04>(input);
+    pPuzzle = std::make_unique<PuzzleDay04Optimized>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+
+    pPuzzle = std::make_unique<PuzzleDay04Optimized>(hugeScoresInput);
+    ASSERT_EQ(std::get<std::string>(pPuzzle->Part1()), hugeScorePart1);
+    ASSERT_EQ(std::get<std::string>(pPuzzle->Part2()), hugeScorePart2);
+}
+
+class Day04ParallelTest : public Day04Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay04Parallel>(exampleInput);
+    }
+};
+
+TEST_F(Day04ParallelTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 4512);
+}
+
+TEST_F(Day04ParallelTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 1924);
+}
+
+TEST_F(Day04ParallelTest, Tournament)
+{
+    // large enough to be split into several blocks of boards
+    const auto input = MakeTournament(9000);
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay04>(input);
+    pPuzzle = std::make_unique<PuzzleDay04Parallel>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+}
+
+TEST_F(Day04ParallelTest, LargeBoards)
+{
+    const auto input = MakeTournament(4, 64, 4096, 1'000'003u);
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay04>(input);
+    pPuzzle = std::make_unique<PuzzleDay04Parallel>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+
+    pPuzzle = std::make_unique<PuzzleDay04Parallel>(hugeScoresInput);
+    ASSERT_EQ(std::get<std::string>(pPuzzle->Part1()), hugeScorePart1);
+    ASSERT_EQ(std::get<std::string>(pPuzzle->Part2()), hugeScorePart2);
+}
+
 } // namespace
 } // namespace AOC::Y2021
@@ -4,17 +4,59 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
+#include <random>
+#include <string>
 #include <string_view>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(05)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(05, Optimized)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(05, Parallel)
 
 namespace
 {
 
+/// Random horizontal, vertical and diagonal lines in a small area, so that they overlap a lot
+std::string MakeVentLines(const int numLines, const int size)
+{
+    std::mt19937 rng;
+    std::uniform_int_distribution<int> coordinate(0, size - 1);
+    std::uniform_int_distribution<int> direction(0, 3);
+    std::string input;
+    for (int i = 0; i != numLines; ++i)
+    {
+        const auto x1 = coordinate(rng);
+        const auto y1 = coordinate(rng);
+        auto x2 = coordinate(rng);
+        auto y2 = coordinate(rng);
+        switch (direction(rng))
+        {
+        case 0:
+            y2 = y1;
+            break;
+        case 1:
+            x2 = x1;
+            break;
+        case 2:
+            y2 = std::min(y1 + std::abs(x2 - x1), size - 1);
+            x2 = x1 + ((x2 > x1) ? 1 : -1) * (y2 - y1);
+            break;
+        default:
+            y2 = std::max(y1 - std::abs(x2 - x1), 0);
+            x2 = x1 + ((x2 > x1) ? 1 : -1) * (y1 - y2);
+            break;
+        }
+        input += std::to_string(x1) + ',' + std::to_string(y1) + " -> " + std::to_string(x2) + ',' +
+                 std::to_string(y2) + '\n';
+    }
+    return input;
+}
+
 class Day05Test : public ::testing::Test
 {
   protected:
@@ -40,5 +82,132 @@ TEST_F(Day05Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 12);
 }
 
+TEST_F(Day05Test, OffsetGridOrigin)
+{
+    // the grid only spans the bounding box of the lines
+    pPuzzle = std::make_unique<PuzzleDay05>("4000000000,4000000000 -> 4000000005,4000000000\r\n"
+                                            "4000000002,3999999998 -> 4000000002,4000000003\r\n"
+                                            "4000000000,3999999999 -> 4000000004,4000000003\r\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 1);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 3);
+}
+
+class Day05OptimizedTest : public Day05Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay05Optimized>(exampleInput);
+    }
+};
+
+TEST_F(Day05OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 5);
+}
+
+TEST_F(Day05OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 12);
+}
+
+TEST_F(Day05OptimizedTest, DenseLines)
+{
+    const auto input = MakeVentLines(1000, 200);
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay05>(input);
+    pPuzzle = std::make_unique<PuzzleDay05Optimized>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+}
+
+TEST_F(Day05OptimizedTest, HugeCoordinates)
+{
+    // a vertical line with a collinear overlap of 100 points, crossed by a horizontal and a diagonal line in the same
+    // point, and a second diagonal crossing the horizontal line
+    pPuzzle = std::make_unique<PuzzleDay05Optimized>("4000000000,0 -> 4000000000,4000000000\n"
+                                                     "4000000000,100 -> 4000000000,199\n"
+                                                     "0,2000000000 -> 4100000000,2000000000\n"
+                                                     "3999999990,1999999990 -> 4000000010,2000000010\n"
+                                                     "0,1999999999 -> 2,2000000001\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 101);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 102);
+}
+
+TEST_F(Day05OptimizedTest, IdenticalLines)
+{
+    std::string input;
+    for (int i = 0; i != 4000; ++i)
+    {
+        input += "0,5 -> 9,5\n5,0 -> 5,9\n";
+    }
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay05>(input);
+    pPuzzle = std::make_unique<PuzzleDay05Optimized>(input);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 19);
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+}
+
+TEST_F(Day05OptimizedTest, AllFamiliesMeetInOnePoint)
+{
+    constexpr std::string_view input = "0,5 -> 10,5\n5,0 -> 5,10\n0,0 -> 10,10\n0,10 -> 10,0\n"
+                                       "4,4 -> 6,6\n";
+    pPuzzle = std::make_unique<PuzzleDay05Optimized>(input);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 1);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 3);
+}
+
+TEST_F(Day05OptimizedTest, DisjointLongAndShortLines)
+{
+    // every vertical line spans the keys of all horizontal lines, but lies to the right of them
+    constexpr int numLines = 40'000;
+    std::string input;
+    for (int i = 0; i != numLines; ++i)
+    {
+        input += "0," + std::to_string(i) + " -> 1000000," + std::to_string(i) + '\n';
+        input += std::to_string(2'000'000 + i) + ",0 -> " + std::to_string(2'000'000 + i) + ',' +
+                 std::to_string(numLines) + '\n';
+    }
+    pPuzzle = std::make_unique<PuzzleDay05Optimized>(input);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 0);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 0);
+}
+
+class Day05ParallelTest : public Day05Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay05Parallel>(exampleInput);
+    }
+};
+
+TEST_F(Day05ParallelTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 5);
+}
+
+TEST_F(Day05ParallelTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 12);
+}
+
+TEST_F(Day05ParallelTest, TiledLines)
+{
+    // large enough to be split into many bands of rows, with lines crossing band and word boundaries
+    const auto input = MakeVentLines(20000, 2000);
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay05>(input);
+    pPuzzle = std::make_unique<PuzzleDay05Parallel>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+}
+
+TEST_F(Day05ParallelTest, OffsetGridOrigin)
+{
+    pPuzzle = std::make_unique<PuzzleDay05Parallel>("4000000000,4000000000 -> 4000000005,4000000000\r\n"
+                                                    "4000000002,3999999998 -> 4000000002,4000000003\r\n"
+                                                    "4000000000,3999999999 -> 4000000004,4000000003\r\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 1);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 3);
+}
+
 } // namespace
 } // namespace AOC::Y2021
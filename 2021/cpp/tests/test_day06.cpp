@@ -1,16 +1,25 @@
 
 #include "ipuzzle.hpp"
+#include "lanternfish_forecast.hpp"
 #include "puzzle_common.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(06)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(06, Optimized)
 
 namespace
 {
@@ -38,5 +47,99 @@ TEST_F(Day06Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 26984457539);
 }
 
+class Day06OptimizedTest : public Day06Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay06Optimized>(exampleInput);
+    }
+};
+
+TEST_F(Day06OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 5934);
+}
+
+TEST_F(Day06OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 26984457539);
+}
+
+TEST(LanternfishForecastTest, RuntimeDays)
+{
+    const LanternfishForecast forecast{{0, 1, 1, 2, 1, 0, 0, 0, 0}};
+    ASSERT_EQ(forecast.GetPopulation(0u), 5);
+    ASSERT_EQ(forecast.GetPopulation(18u), 26);
+    ASSERT_EQ(forecast.GetPopulation(80u), 5934);
+    ASSERT_EQ(forecast.GetPopulation(256u), 26984457539);
+    ASSERT_EQ(forecast.GetPopulation(481u), 8774420512133972281);
+    ASSERT_FALSE(forecast.GetPopulation(482u).has_value());
+    ASSERT_FALSE(forecast.GetPopulation(1'000'000'000'000u).has_value());
+}
+
+TEST(LanternfishForecastTest, LookupTableMatchesMatrix)
+{
+    const LanternfishForecast forecast{{0, 1, 1, 2, 1, 0, 0, 0, 0}};
+    for (std::uint64_t days = 0u; days != 300u; ++days)
+    {
+        ASSERT_EQ(std::to_string(forecast.GetPopulation(days).value()), forecast.GetPopulation128(days)) << days;
+    }
+    const LanternfishForecast hugeForecast{{0, 0, 0, 0, 0, 0, 0, 0, std::numeric_limits<std::int64_t>::max() / 2}};
+    ASSERT_EQ(hugeForecast.GetPopulation(9u), std::numeric_limits<std::int64_t>::max() - 1);
+    ASSERT_FALSE(hugeForecast.GetPopulation(16u).has_value());
+    const LanternfishForecast negativeForecast{{-1, 0, 0, 0, 0, 0, 0, 0, 0}};
+    ASSERT_FALSE(negativeForecast.GetPopulation(80u).has_value());
+}
+
+TEST(LanternfishForecastTest, BatchedHorizons)
+{
+    const LanternfishForecast forecast{{0, 1, 1, 2, 1, 0, 0, 0, 0}};
+    std::vector<std::uint64_t> days{0u, 0u, 1u, 18u, 80u, 256u, 481u, 482u, 1'000'000'000'000u};
+    for (std::uint64_t day = 1000u; day < 200'000u; day += 997u)
+    {
+        days.insert(days.end() - 1, day % 480u);
+    }
+    std::ranges::sort(days);
+    const auto populations = forecast.GetPopulations(days);
+    ASSERT_EQ(populations.size(), days.size());
+    for (std::size_t i = 0; i != days.size(); ++i)
+    {
+        ASSERT_EQ(populations[i], forecast.GetPopulation(days[i])) << days[i];
+    }
+    const std::vector<std::uint64_t> sparseDays{300u, 481u, 482u, 4096u};
+    const std::vector<std::optional<std::int64_t>> sparsePopulations{
+        forecast.GetPopulation(300u), 8774420512133972281, std::nullopt, std::nullopt};
+    ASSERT_EQ(forecast.GetPopulations(sparseDays), sparsePopulations);
+    ASSERT_TRUE(forecast.GetPopulations({}).empty());
+    const std::vector<std::uint64_t> unsortedDays{80u, 18u};
+    ASSERT_TRUE(forecast.GetPopulations(unsortedDays).empty());
+}
+
+TEST(LanternfishForecastTest, WideAndExactPopulation)
+{
+    const LanternfishForecast forecast{{0, 1, 1, 2, 1, 0, 0, 0, 0}};
+    ASSERT_EQ(forecast.GetPopulation128(0u), "5");
+    ASSERT_EQ(forecast.GetPopulation128(482u), "9572239824574035928");
+    ASSERT_EQ(forecast.GetPopulation128(998u), "318892759258767436907541348343071883668");
+    ASSERT_FALSE(forecast.GetPopulation128(999u).has_value());
+    ASSERT_EQ(forecast.GetExactPopulation(80u), "5934");
+    ASSERT_EQ(forecast.GetExactPopulation(998u), "318892759258767436907541348343071883668");
+    ASSERT_EQ(forecast.GetExactPopulation(1000u), "379589061144698259131825683795505058481");
+    ASSERT_EQ(LanternfishForecast{{}}.GetExactPopulation(1000u), "0");
+}
+
+TEST(LanternfishForecastTest, PopulationModulo)
+{
+    const LanternfishForecast forecast{{0, 1, 1, 2, 1, 0, 0, 0, 0}};
+    constexpr std::uint32_t prime = 1'000'000'007u;
+    ASSERT_EQ(forecast.GetPopulationModulo(80u, prime), 5934u);
+    ASSERT_EQ(forecast.GetPopulationModulo(256u, prime), 26984457539u % prime);
+    ASSERT_EQ(forecast.GetPopulationModulo(1000u, prime), 892908140u);
+    ASSERT_EQ(forecast.GetPopulationModulo(1'000'000'000'000u, prime), 995077479u);
+    ASSERT_EQ(forecast.GetPopulationModulo(1000u, 1u), 0u);
+    ASSERT_FALSE(forecast.GetPopulationModulo(80u, 0u).has_value());
+}
+
 } // namespace
 } // namespace AOC::Y2021
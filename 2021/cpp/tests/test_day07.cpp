@@ -1,16 +1,23 @@
 
+#include "crab_alignment.hpp"
 #include "ipuzzle.hpp"
 #include "puzzle_common.hpp"
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <random>
+#include <string>
 #include <string_view>
+#include <utility>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(07)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(07, Optimized)
 
 namespace
 {
@@ -38,5 +45,92 @@ TEST_F(Day07Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 168);
 }
 
+TEST(Day07AlignmentFuelTest, ExampleInput)
+{
+    constexpr std::uint64_t histogram[] = {1, 2, 3, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1};
+    ASSERT_EQ(std::get<std::int64_t>(CalculateAlignmentFuel(histogram, 2u, true)), 37);
+    ASSERT_EQ(std::get<std::int64_t>(CalculateAlignmentFuel(histogram, 5u, false)), 168);
+}
+
+TEST(Day07AlignmentFuelTest, FuelBeyond64Bit)
+{
+    // 2^63 + 4 crabs may burn more than 64 bit of fuel, so every position is accumulated in 128 bit
+    constexpr std::uint64_t histogram[] = {std::uint64_t{1} << 63u, 0u, 0u, 4u};
+    ASSERT_EQ(std::get<std::int64_t>(CalculateAlignmentFuel(histogram, 0u, true)), 12);
+    ASSERT_EQ(std::get<std::int64_t>(CalculateAlignmentFuel(histogram, 0u, false)), 24);
+    ASSERT_EQ(std::get<std::string>(CalculateAlignmentFuel(histogram, 3u, true)), "27670116110564327424");
+    ASSERT_EQ(std::get<std::string>(CalculateAlignmentFuel(histogram, 3u, false)), "55340232221128654848");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(CalculateAlignmentFuel(histogram, 4u, true)));
+}
+
+std::string MakeCrabPositions(const std::size_t numCrabs, const std::uint32_t maxPosition, const unsigned seed)
+{
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<std::uint32_t> position(0u, maxPosition);
+    std::string input;
+    for (std::size_t i = 0; i != numCrabs; ++i)
+    {
+        input += std::to_string(position(rng));
+        input += (i + 1u != numCrabs) ? ',' : '\n';
+    }
+    return input;
+}
+
+class Day07OptimizedTest : public Day07Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay07Optimized>(exampleInput);
+    }
+};
+
+TEST_F(Day07OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 37);
+}
+
+TEST_F(Day07OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 168);
+}
+
+TEST_F(Day07OptimizedTest, DenseAndSparsePositions)
+{
+    for (const auto &[numCrabs, maxPosition] : {std::pair<std::size_t, std::uint32_t>{1u, 0u},
+                                                {2u, 5u},
+                                                {1000u, 2000u},
+                                                {999u, 300u},
+                                                {20u, 3000u},
+                                                {7u, 1000u}})
+    {
+        for (unsigned seed = 0u; seed != 3u; ++seed)
+        {
+            const auto input = MakeCrabPositions(numCrabs, maxPosition, seed);
+            std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay07>(input);
+            pPuzzle = std::make_unique<PuzzleDay07Optimized>(input);
+            ASSERT_EQ(pPuzzle->Part1(), pReference->Part1()) << input;
+            ASSERT_EQ(pPuzzle->Part2(), pReference->Part2()) << input;
+        }
+    }
+}
+
+TEST_F(Day07OptimizedTest, HugeSparseRange)
+{
+    pPuzzle = std::make_unique<PuzzleDay07Optimized>("0,2147483648\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 2147483648);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 1152921505680588800);
+    pPuzzle = std::make_unique<PuzzleDay07Optimized>("1000000000,1000000003,3000000000,1000000001,1000000001\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 2000000002);
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 1599999999600000002);
+}
+
+TEST_F(Day07OptimizedTest, FuelBeyond64Bit)
+{
+    pPuzzle = std::make_unique<PuzzleDay07Optimized>("0,0,0,4294967295,4294967295,4294967295\n");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 12884901885);
+    ASSERT_EQ(std::get<std::string>(pPuzzle->Part2()), "13835058055282163712");
+}
+
 } // namespace
 } // namespace AOC::Y2021
@@ -4,14 +4,20 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <random>
+#include <string>
 #include <string_view>
 
 namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(08)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(08, Optimized)
 
 namespace
 {
@@ -72,5 +78,72 @@ constexpr Day08TestParams day08ExamplesInOut[] = {
 };
 INSTANTIATE_TEST_SUITE_P(Day08Examples, Day08Test, testing::ValuesIn(day08ExamplesInOut));
 
+class Day08OptimizedTest : public Day08Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay08Optimized>(GetParam().input);
+    }
+};
+
+TEST_P(Day08OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), GetParam().expectedResultPart1);
+}
+
+TEST_P(Day08OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), GetParam().expectedResultPart2);
+}
+
+INSTANTIATE_TEST_SUITE_P(Day08Examples, Day08OptimizedTest, testing::ValuesIn(day08ExamplesInOut));
+
+/// displays with random wirings, shuffled patterns and random output digits
+std::string MakeDisplays(const std::size_t numDisplays, const unsigned seed)
+{
+    constexpr std::array<std::string_view, 10u> digits = {"abcefg", "cf",     "acdeg", "acdfg",   "bcdf",
+                                                           "abdfg",  "abdefg", "acf",   "abcdefg", "abcdfg"};
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<std::size_t> randomDigit(0u, digits.size() - 1u);
+    std::string input;
+    for (std::size_t i = 0; i != numDisplays; ++i)
+    {
+        std::string wiring = "abcdefg";
+        std::ranges::shuffle(wiring, rng);
+        const auto fnWire = [&](const std::string_view digit) {
+            std::string pattern;
+            for (const auto segment : digit)
+            {
+                pattern += wiring[static_cast<std::size_t>(segment - 'a')];
+            }
+            std::ranges::shuffle(pattern, rng);
+            return pattern;
+        };
+        auto patterns = digits;
+        std::ranges::shuffle(patterns, rng);
+        for (const auto pattern : patterns)
+        {
+            input += fnWire(pattern) + ' ';
+        }
+        input += '|';
+        for (std::size_t output = 0; output != 4u; ++output)
+        {
+            input += ' ' + fnWire(digits[randomDigit(rng)]);
+        }
+        input += '\n';
+    }
+    return input;
+}
+
+TEST(Day08OptimizedRandomTest, RandomWirings)
+{
+    const auto input = MakeDisplays(2000u, 8u);
+    std::unique_ptr<IPuzzle> pReference = std::make_unique<PuzzleDay08>(input);
+    std::unique_ptr<IPuzzle> pPuzzle = std::make_unique<PuzzleDay08Optimized>(input);
+    ASSERT_EQ(pPuzzle->Part1(), pReference->Part1());
+    ASSERT_EQ(pPuzzle->Part2(), pReference->Part2());
+}
+
 } // namespace
 } // namespace AOC::Y2021
@@ -11,6 +11,7 @@ namespace AOC::Y2021
 {
 
 AOC_Y2021_PUZZLE_CLASS_DECLARATION(15)
+AOC_Y2021_PUZZLE_ENGINE_CLASS_DECLARATION(15, Optimized)
 
 namespace
 {
@@ -40,5 +41,30 @@ TEST_F(Day15Test, Part2)
     ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 315);
 }
 
+class Day15OptimizedTest : public Day15Test
+{
+  protected:
+    void SetUp() override
+    {
+        pPuzzle = std::make_unique<PuzzleDay15Optimized>(exampleInput);
+    }
+};
+
+TEST_F(Day15OptimizedTest, Part1)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 40);
+}
+
+TEST_F(Day15OptimizedTest, Part2)
+{
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 315);
+}
+
+TEST_F(Day15OptimizedTest, NonSquareMap)
+{
+    pPuzzle = std::make_unique<PuzzleDay15Optimized>("1911\n1911\n1111");
+    ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 5);
+}
+
 } // namespace
 } // namespace AOC::Y2021
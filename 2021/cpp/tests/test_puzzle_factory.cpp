@@ -0,0 +1,102 @@
+#include "ipuzzle.hpp"
+#include "puzzle_factory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace AOC::Y2021
+{
+
+namespace
+{
+
+constexpr std::string_view day15ExampleInput =
+    "1163751742\n1381373672\n2136511328\n3694931569\n7463417111\n1319128137\n1359912421\n3125421639\n1293138521\n23"
+    "11944581";
+
+/// puzzle returning fixed solutions, standing in for an engine under test
+class StubPuzzle final : public IPuzzle
+{
+  public:
+    StubPuzzle(Solution_t part1, Solution_t part2) : part1(std::move(part1)), part2(std::move(part2))
+    {
+    }
+
+    [[nodiscard]] Solution_t Part1() override
+    {
+        return part1;
+    }
+
+    [[nodiscard]] Solution_t Part2() override
+    {
+        return part2;
+    }
+
+  private:
+    Solution_t part1;
+    Solution_t part2;
+};
+
+} // namespace
+
+TEST(PuzzleFactoryTest, GetEngines)
+{
+    ASSERT_EQ(PuzzleFactory::GetEngines(15u), (std::vector<PuzzleEngine>{PuzzleEngine::Reference,
+                                                                          PuzzleEngine::Optimized}));
+    ASSERT_TRUE(PuzzleFactory::GetEngines(0u).empty());
+    ASSERT_TRUE(PuzzleFactory::GetEngines(99u).empty());
+}
+
+TEST(PuzzleFactoryTest, CreatePuzzle)
+{
+    for (const auto engine : PuzzleFactory::GetEngines(15u))
+    {
+        const auto pPuzzle = PuzzleFactory::CreatePuzzle(15u, day15ExampleInput, engine);
+        ASSERT_NE(pPuzzle, nullptr);
+        ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part1()), 40);
+        ASSERT_EQ(std::get<std::int64_t>(pPuzzle->Part2()), 315);
+    }
+    ASSERT_EQ(PuzzleFactory::CreatePuzzle(15u, day15ExampleInput, PuzzleEngine::Parallel), nullptr);
+    ASSERT_EQ(PuzzleFactory::CreatePuzzle(99u, day15ExampleInput), nullptr);
+}
+
+TEST(PuzzleFactoryTest, EngineNames)
+{
+    for (const auto engine : {PuzzleEngine::Reference, PuzzleEngine::Optimized, PuzzleEngine::Parallel})
+    {
+        ASSERT_EQ(PuzzleFactory::ParseEngineName(PuzzleFactory::GetEngineName(engine)), engine);
+    }
+    ASSERT_EQ(PuzzleFactory::GetEngineName(PuzzleEngine::Optimized), "optimized");
+    ASSERT_FALSE(PuzzleFactory::ParseEngineName("bogus").has_value());
+    ASSERT_FALSE(PuzzleFactory::ParseEngineName("").has_value());
+}
+
+TEST(PuzzleFactoryTest, VerifyEngines)
+{
+    ASSERT_TRUE(PuzzleFactory::VerifyEngines(15u, day15ExampleInput).empty());
+    ASSERT_TRUE(PuzzleFactory::VerifyEngines(99u, day15ExampleInput).empty());
+}
+
+TEST(PuzzleFactoryTest, CompareSolutions)
+{
+    StubPuzzle agreeing(std::int64_t{40}, std::int64_t{315});
+    ASSERT_TRUE(PuzzleFactory::CompareSolutions(PuzzleEngine::Optimized, agreeing, std::int64_t{40},
+                                                std::int64_t{315})
+                    .empty());
+
+    StubPuzzle disagreeing(std::int64_t{40}, std::monostate{});
+    const auto mismatches =
+        PuzzleFactory::CompareSolutions(PuzzleEngine::Parallel, disagreeing, std::int64_t{40}, std::int64_t{315});
+    ASSERT_EQ(mismatches.size(), 1u);
+    ASSERT_EQ(mismatches[0].engine, PuzzleEngine::Parallel);
+    ASSERT_EQ(mismatches[0].part, 2u);
+    ASSERT_EQ(mismatches[0].expected, IPuzzle::Solution_t{std::int64_t{315}});
+    ASSERT_EQ(mismatches[0].actual, IPuzzle::Solution_t{std::monostate{}});
+}
+
+} // namespace AOC::Y2021
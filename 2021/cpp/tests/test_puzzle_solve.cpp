@@ -0,0 +1,76 @@
+#include "ipuzzle.hpp"
+#include "puzzle_factory.hpp"
+#include "puzzle_solve.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace AOC::Y2021
+{
+
+namespace
+{
+
+constexpr std::uint8_t numSupportedDays = 15u;
+
+/// Solve<DAY>() of every supported day, indexed by DAY - 1
+template <std::size_t... INDICES> constexpr auto MakeStaticSolvers(std::index_sequence<INDICES...>)
+{
+    return std::array{&Solve<static_cast<std::uint8_t>(INDICES + 1u)>...};
+}
+constexpr auto staticSolvers = MakeStaticSolvers(std::make_index_sequence<numSupportedDays>{});
+
+std::string ReadPuzzleInput(const std::uint8_t day)
+{
+    char fileName[16];
+    std::snprintf(fileName, sizeof(fileName), "/day%02u.txt", unsigned(day));
+    std::ifstream ifs(std::string(AOC_Y2021_INPUT_DIR) + fileName);
+    return {std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+}
+
+class PuzzleSolveTest : public testing::TestWithParam<std::uint8_t>
+{
+};
+
+TEST_P(PuzzleSolveTest, StaticDispatch)
+{
+    const auto day = GetParam();
+    const auto input = ReadPuzzleInput(day);
+    ASSERT_FALSE(input.empty());
+    const auto pPuzzle = PuzzleFactory::CreatePuzzle(day, input);
+    ASSERT_NE(pPuzzle, nullptr);
+    const auto expectedPart1 = pPuzzle->Part1();
+    const auto expectedPart2 = pPuzzle->Part2();
+
+    const auto solution = staticSolvers[day - 1u](input);
+    ASSERT_EQ(solution.part1, expectedPart1);
+    ASSERT_EQ(solution.part2, expectedPart2);
+    const auto runtimeSolution = Solve(day, input);
+    ASSERT_EQ(runtimeSolution.part1, expectedPart1);
+    ASSERT_EQ(runtimeSolution.part2, expectedPart2);
+}
+
+INSTANTIATE_TEST_SUITE_P(SupportedDays, PuzzleSolveTest,
+                         testing::Range<std::uint8_t>(1u, static_cast<std::uint8_t>(numSupportedDays + 1u)),
+                         [](const testing::TestParamInfo<std::uint8_t> &info) {
+                             return "Day" + std::to_string(unsigned(info.param));
+                         });
+
+TEST(PuzzleSolveUnsupportedDayTest, StaticDispatch)
+{
+    const auto solution = Solve(99u, "");
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(solution.part1));
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(solution.part2));
+}
+
+} // namespace
+} // namespace AOC::Y2021